@@ -11,3 +11,6 @@ val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
 
 (./charpoly-Danilevskii-LUK > charpoly-Danilevskii-LUK-threshold.h) 2>&1 | tee charpoly-Danilevskii-LUK-autotune.log
 val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
+
+(./charpoly-auto > charpoly-auto-table.h) 2>&1 | tee charpoly-auto-autotune.log
+val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
@@ -0,0 +1,7 @@
+#!/bin/bash
+echo =================================================
+echo ========= FFLAS-FFPACK GF(2) Autotuning =========
+echo =================================================
+echo 
+(./gf2 > gf2-threshold.h) 2>&1 | tee gf2-autotune.log
+val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
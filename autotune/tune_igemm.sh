@@ -0,0 +1,22 @@
+#!/bin/bash
+echo =================================================
+echo ========= FFLAS-FFPACK igemm Autotuning =========
+echo =================================================
+echo 
+echo "== Tuning igemm blocking with a micro-kernel of 1 simd vector rows =="
+(./igemm-mr1 > igemm-mr1-blocking.h) 2>&1 | tee igemm-autotune.log
+val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
+echo 
+echo "== Tuning igemm blocking with a micro-kernel of 2 simd vector rows =="
+(./igemm-mr2 > igemm-mr2-blocking.h) 2>&1 | tee -a igemm-autotune.log
+val=${PIPESTATUS[0]}; if test ${val} -ne 0 ; then exit ${val}; fi
+echo 
+# keep the fastest micro-kernel shape
+speed1=`sed -n 's|^// igemm Gfops ||p' igemm-mr1-blocking.h`
+speed2=`sed -n 's|^// igemm Gfops ||p' igemm-mr2-blocking.h`
+if test -n "${speed1}" && awk "BEGIN{exit !(${speed1} > ${speed2:-0})}" ; then
+	cp igemm-mr1-blocking.h igemm-blocking.h
+else
+	cp igemm-mr2-blocking.h igemm-blocking.h
+fi
+echo "== Selected micro-kernel: `grep 'define __FFLASFFPACK_IGEMM_MR_VECTORS' igemm-blocking.h` ==" | tee -a igemm-autotune.log
@@ -0,0 +1,65 @@
+#!/bin/bash
+# Compares benchmark records against a stored baseline and flags the slowdowns.
+# Records are the csv output of the benchmarks, see fflas-ffpack/utils/bench-utils.h:
+#   FFLAS_BENCH_FORMAT=csv FFLAS_BENCH_OUTPUT=baseline.csv ./benchmark-fgemm -m 1000
+# Usage: bench-compare.sh baseline.csv current.csv [tolerance]
+# A benchmark (same name and same arguments) is reported as a slowdown when its
+# median time exceeds the baseline one by more than tolerance (default 0.05, i.e. 5%)
+# and by more than the sum of the two confidence intervals.
+# Records flagged unstable by the reproducible mode (FFLAS_BENCH_REPRODUCIBLE) are
+# reported but never counted as slowdowns.
+# Returns 1 when at least one slowdown is found.
+
+BASELINE=$1
+CURRENT=$2
+TOLERANCE=${3:-0.05}
+
+if [[ ! -f $BASELINE || ! -f $CURRENT ]]
+then
+	echo 'Usage: '$0' baseline.csv current.csv [tolerance]'
+	exit 2
+fi
+
+awk -F',' -v tol="$TOLERANCE" '
+# column indices are read from the header of each file
+FNR == 1 { file++ }
+$1 == "benchmark" {
+	for (i = 1; i <= NF; i++) col[file, $i] = i
+	next
+}
+file == 1 {
+	key = $col[1,"benchmark"] " " $col[1,"args"]
+	base[key] = $col[1,"median"]
+	baseci[key] = $col[1,"ci"]
+	basestable[key] = ((1,"stable") in col) ? $col[1,"stable"] : 1
+	next
+}
+file == 2 {
+	key = $col[2,"benchmark"] " " $col[2,"args"]
+	if (!(key in base)) {
+		printf "%-10s %s\n", "[new]", key
+		next
+	}
+	b = base[key]; c = $col[2,"median"]
+	ratio = (b > 0) ? c / b : 1
+	stable = basestable[key] && (((2,"stable") in col) ? $col[2,"stable"] : 1)
+	if (!stable) {
+		status = "[unstable]"
+	} else if (c > b * (1 + tol) && c - b > baseci[key] + $col[2,"ci"]) {
+		status = "[SLOWER]"; slow++
+	} else if (c < b * (1 - tol) && b - c > baseci[key] + $col[2,"ci"]) {
+		status = "[faster]"
+	} else {
+		status = "[ok]"
+	}
+	printf "%-10s %s: %g s -> %g s (x%.3f)\n", status, key, b, c, ratio
+	seen[key] = 1
+}
+END {
+	for (key in base)
+		if (!(key in seen)) printf "%-10s %s\n", "[missing]", key
+	if (slow) {
+		print slow " slowdown(s) against the baseline."
+		exit 1
+	}
+}' "$BASELINE" "$CURRENT"
@@ -0,0 +1,228 @@
+/* checkers/checker_batch.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_batch_INL
+#define __FFLASFFPACK_checker_batch_INL
+
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FFLAS {
+
+    /** Verification of a batch of operations with a single random projection.
+     *
+     * Each operation contributes its residue E_i.V (E_i being the difference between
+     * the computed result and the expected one, V a n x t block of random vectors
+     * shared by the whole batch), scaled by random coefficients r_i, to an accumulator.
+     * The check() of the derived checkers then tests once that the accumulator is zero.
+     * A wrong result goes undetected with probability at most ((2c-1)/c^2)^t, where c is
+     * the cardinality of the field: t is chosen from the error bound given at construction.
+     *
+     * In asynchronous mode, the part of the verification made after the operation runs on a
+     * background thread: the operands must then stay unchanged until the next call to check().
+     */
+    template <class Field>
+    class CheckerBatch {
+    public:
+        typedef typename Field::Element Element;
+        typedef typename Field::Element_ptr Element_ptr;
+
+        /// Random coefficients of one operation in the linear combination
+        struct Ticket {
+            std::vector<Element> r;
+        };
+
+        size_t projections () const { return _t; }
+
+        /// Number of operations recorded since the last check
+        size_t pending () const { return _count; }
+
+        /// Waits for the pending verifications and tests the accumulated residue
+        bool verify ()
+        {
+            wait();
+            std::lock_guard<std::mutex> lock (_mtx);
+            bool pass = FFLAS::fiszero (F, _mAcc, _t, _acc, _t);
+            FFLAS::fzero (F, _mAcc, _t, _acc, _t);
+            _count = 0;
+            return pass;
+        }
+
+    protected:
+        const Field& F;
+
+        CheckerBatch (const Field& F_, double errorBound, bool async, uint64_t seed) :
+            F(F_), G(F_, seed), _t(nbProjections (F_, errorBound)),
+            _nV(0), _mAcc(0), _sizeW(0), _sizeT(0),
+            _V(nullptr), _acc(nullptr), _W(nullptr), _T(nullptr),
+            _count(0), _running(0), _stop(false)
+        {
+            if (async) _worker = std::thread (&CheckerBatch::work, this);
+        }
+
+        ~CheckerBatch ()
+        {
+            if (_worker.joinable()) {
+                wait();
+                {
+                    std::lock_guard<std::mutex> lock (_queueMtx);
+                    _stop = true;
+                }
+                _cv.notify_all();
+                _worker.join();
+            }
+            FFLAS::fflas_delete (_V, _acc, _W, _T);
+        }
+
+        /// Draws the coefficients of a new operation
+        Ticket newTicket ()
+        {
+            Ticket tk;
+            tk.r.resize (_t);
+            std::lock_guard<std::mutex> lock (_mtx);
+            for (size_t j = 0; j < _t; ++j)
+                G.random (tk.r[j]);
+            ++_count;
+            return tk;
+        }
+
+        /// Random block of at least n rows, ld = projections(); _mtx must be held
+        Element_ptr projection (size_t n)
+        {
+            if (n > _nV) {
+                Element_ptr V = FFLAS::fflas_new (F, n, _t);
+                if (_nV) FFLAS::fassign (F, _nV, _t, _V, _t, V, _t);
+                FFLAS::frand (F, G, n-_nV, _t, V+_nV*_t, _t);
+                FFLAS::fflas_delete (_V);
+                _V = V; _nV = n;
+            }
+            return _V;
+        }
+
+        /// Scratch blocks of m rows, ld = projections(); _mtx must be held
+        Element_ptr scratchW (size_t m) { return grow (_W, _sizeW, m); }
+        Element_ptr scratchT (size_t m) { return grow (_T, _sizeT, m); }
+
+        /// acc <- acc + s.r_j.W[:,j] on the first m rows; _mtx must be held
+        void accumulate (const Ticket& tk, bool negate, size_t m, Element_ptr W)
+        {
+            if (m > _mAcc) {
+                Element_ptr acc = FFLAS::fflas_new (F, m, _t);
+                FFLAS::fzero (F, m, _t, acc, _t);
+                if (_mAcc) FFLAS::fassign (F, _mAcc, _t, _acc, _t, acc, _t);
+                FFLAS::fflas_delete (_acc);
+                _acc = acc; _mAcc = m;
+            }
+            Element s;
+            for (size_t j = 0; j < _t; ++j) {
+                if (negate) F.neg (s, tk.r[j]); else F.assign (s, tk.r[j]);
+                FFLAS::faxpy (F, m, s, W+j, _t, _acc+j, _t);
+            }
+        }
+
+        /// Runs the task on the worker in asynchronous mode, right away otherwise
+        void submit (const std::function<void()>& task)
+        {
+            if (!_worker.joinable()) { task(); return; }
+            {
+                std::lock_guard<std::mutex> lock (_queueMtx);
+                _queue.push_back (task);
+            }
+            _cv.notify_all();
+        }
+
+        /// Waits for the tasks submitted so far: to be called by the destructors of the derived classes
+        void wait ()
+        {
+            std::unique_lock<std::mutex> lock (_queueMtx);
+            _cv.wait (lock, [this]{ return _queue.empty() && !_running; });
+        }
+
+        std::mutex _mtx;
+
+    private:
+        typename Field::RandIter G;
+        const size_t _t;
+        size_t _nV, _mAcc, _sizeW, _sizeT;
+        Element_ptr _V, _acc, _W, _T;
+        size_t _count;
+
+        std::thread _worker;
+        std::mutex _queueMtx;
+        std::condition_variable _cv;
+        std::deque<std::function<void()> > _queue;
+        size_t _running;
+        bool _stop;
+
+        CheckerBatch (const CheckerBatch&) = delete;
+        CheckerBatch& operator= (const CheckerBatch&) = delete;
+
+        static size_t nbProjections (const Field& F, double errorBound)
+        {
+            Givaro::Integer card;
+            F.cardinality (card);
+            if (card <= 0 || errorBound <= 0. || errorBound >= 1.) return 1;
+            const double c = double(card);
+            const double q = (2*c-1)/(c*c);
+            if (q >= 1.) return 1;
+            return std::max (size_t(1), size_t (std::ceil (std::log (errorBound) / std::log (q))));
+        }
+
+        Element_ptr grow (Element_ptr& X, size_t& size, size_t m)
+        {
+            if (m > size) {
+                FFLAS::fflas_delete (X);
+                X = FFLAS::fflas_new (F, m, _t);
+                size = m;
+            }
+            return X;
+        }
+
+        void work ()
+        {
+            std::unique_lock<std::mutex> lock (_queueMtx);
+            while (true) {
+                _cv.wait (lock, [this]{ return _stop || !_queue.empty(); });
+                if (_queue.empty()) return;
+                std::function<void()> task = _queue.front();
+                _queue.pop_front();
+                ++_running;
+                lock.unlock();
+                task();
+                lock.lock();
+                --_running;
+                _cv.notify_all();
+            }
+        }
+    };
+
+}
+
+#endif // __FFLASFFPACK_checker_batch_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
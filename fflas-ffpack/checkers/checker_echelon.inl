@@ -0,0 +1,183 @@
+/* checkers/checker_echelon.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_echelon_INL
+#define __FFLASFFPACK_checker_echelon_INL
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK {
+
+    /** Checker of the (reduced) row echelon decompositions X.A = E computed by
+     * RowEchelonForm and ReducedRowEchelonForm with transform = true.
+     * X and E are applied to the projections directly from the compact storage, following their
+     * extraction by getEchelonTransform and getEchelonForm (resp. the reduced variants), so that X is
+     * invertible and E in (reduced) echelon form by construction: it remains to check that X.(A.v) == E.v.
+     * Without the transformation, the decomposition can not be certified and is accepted.
+     */
+    template <class Field>
+    class CheckerImplem_echelon {
+
+        const Field& F;
+        typename Field::Element_ptr v,w;
+        const size_t m,n;
+        const bool reduced;
+
+    public:
+        CheckerImplem_echelon(const Field& F_, const size_t m_, const size_t n_,
+                              typename Field::ConstElement_ptr A, const size_t lda, const bool reduced_ = false)
+        : F(F_), v(FFLAS::fflas_new(F_,n_)), w(FFLAS::fflas_new(F_,m_)), m(m_), n(n_), reduced(reduced_)
+        {
+            typename Field::RandIter G(F);
+            init(G,A,lda);
+        }
+
+        CheckerImplem_echelon(typename Field::RandIter &G, const size_t m_, const size_t n_,
+                              typename Field::ConstElement_ptr A, const size_t lda, const bool reduced_ = false)
+        : F(G.ring()), v(FFLAS::fflas_new(F,n_)), w(FFLAS::fflas_new(F,m_)), m(m_), n(n_), reduced(reduced_)
+        {
+            init(G,A,lda);
+        }
+
+        ~CheckerImplem_echelon() {
+            FFLAS::fflas_delete(v,w);
+        }
+
+        /** check if the echelon decomposition is correct.
+         * @param A the compact storage of the decomposition
+         * @param lda
+         * @param r the rank returned
+         * @param P the row permutation
+         * @param Qt the column positions of the pivots
+         * @param transform whether the transformation was computed
+         * @param LuTag the elimination algorithm used
+         */
+        inline bool check(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                          const size_t* P, const size_t* Qt, const bool transform,
+                          const FFPACK_LU_TAG LuTag) const {
+            if (!transform || !m || !n) return true;
+            typename Field::Element_ptr x = FFLAS::fflas_new(F,std::max(m,n));
+            typename Field::Element_ptr y = FFLAS::fflas_new(F,std::max(m,n));
+            FFLAS::fassign(F, m, w, 1, x, 1);
+            FFLAS::fassign(F, n, v, 1, y, 1);
+            if (reduced){
+                applyReducedTransform(A, lda, r, P, Qt, LuTag, x);
+                applyReducedForm(A, lda, r, Qt, LuTag, y);
+            } else {
+                applyTransform(A, lda, r, P, Qt, LuTag, x);
+                applyForm(A, lda, r, Qt, LuTag, y);
+            }
+            bool pass = FFLAS::fequal(F, m, x, 1, y, 1);
+            FFLAS::fflas_delete(x,y);
+            if (!pass) throw FailureEchelonCheck();
+            return pass;
+        }
+
+    private:
+        // Applies the row echelon pivots Qt to the first r entries of x, as getEchelonForm on tiles
+        inline void applyEchelonPermutation(const size_t r, const size_t* Qt, typename Field::Element_ptr x) const {
+            size_t * LPerm = FFLAS::fflas_new<size_t>(r);
+            PLUQtoEchelonPermutation (n, r, Qt, LPerm);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, r, x, 1, LPerm);
+            FFLAS::fflas_delete(LPerm);
+        }
+
+        // x <- X.x with X = [L1 0; L2 I].P as built by getEchelonTransform
+        inline void applyTransform(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                                   const size_t* P, const size_t* Qt, const FFPACK_LU_TAG LuTag,
+                                   typename Field::Element_ptr x) const {
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, (LuTag == FfpackTileRecursive) ? m : r, x, 1, P);
+            if (r < m)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-r, 1, r, F.one, A+r*lda, lda, x, 1, F.one, x+r, 1);
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, 1, F.one, A, lda, x, 1);
+            if (LuTag == FfpackTileRecursive)
+                applyEchelonPermutation(r, Qt, x);
+        }
+
+        // y <- E.y with E in row echelon form, unit pivots, as built by getEchelonForm
+        inline void applyForm(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                              const size_t* Qt, const FFPACK_LU_TAG LuTag,
+                              typename Field::Element_ptr y) const {
+            if (LuTag != FfpackTileRecursive){
+                // row i only involves the columns from its pivot Qt[i] >= i
+                for (size_t i = 0; i < r; ++i){
+                    typename Field::Element t;
+                    F.init(t);
+                    F.assign(t, y[Qt[i]]);
+                    F.addin(t, FFLAS::fdot(F, n-Qt[i]-1, A+i*lda+Qt[i]+1, 1, y+Qt[i]+1, 1));
+                    F.assign(y[i], t);
+                }
+            } else {
+                applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, n, y, 1, Qt);
+                FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, 1, F.one, A, lda, y, 1);
+                if (r < n)
+                    FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, 1, n-r, F.one, A+r, lda, y+r, 1, F.one, y, 1);
+            }
+            FFLAS::fzero(F, m-r, y+r, 1);
+            if (LuTag == FfpackTileRecursive)
+                applyEchelonPermutation(r, Qt, y);
+        }
+
+        // x <- X.x with X = [X1 0; X2 I].P as built by getReducedEchelonTransform
+        inline void applyReducedTransform(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                                          const size_t* P, const size_t* Qt, const FFPACK_LU_TAG LuTag,
+                                          typename Field::Element_ptr x) const {
+            const bool tile = (LuTag == FfpackTileRecursive || LuTag == FfpackGaussJordanTile);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, tile ? m : r, x, 1, P);
+            if (r < m)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-r, 1, r, F.one, A+r*lda, lda, x, 1, F.one, x+r, 1);
+            typename Field::Element_ptr x1 = FFLAS::fflas_new(F,r);
+            FFLAS::fassign(F, r, x, 1, x1, 1);
+            FFLAS::fgemv(F, FFLAS::FflasNoTrans, r, r, F.one, A, lda, x1, 1, F.zero, x, 1);
+            FFLAS::fflas_delete(x1);
+            if (LuTag != FfpackSlabRecursive)
+                applyEchelonPermutation(r, Qt, x);
+        }
+
+        // y <- E.y with E = [I E2].Qt in reduced row echelon form, as built by getReducedEchelonForm
+        inline void applyReducedForm(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                                     const size_t* Qt, const FFPACK_LU_TAG LuTag,
+                                     typename Field::Element_ptr y) const {
+            const bool tile = (LuTag == FfpackTileRecursive || LuTag == FfpackGaussJordanTile);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, (LuTag == FfpackSlabRecursive) ? r : n, y, 1, Qt);
+            if (r < n)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, 1, n-r, F.one, A+r, lda, y+r, 1, F.one, y, 1);
+            FFLAS::fzero(F, m-r, y+r, 1);
+            if (tile)
+                applyEchelonPermutation(r, Qt, y);
+        }
+
+        inline void init(typename Field::RandIter &G, typename Field::ConstElement_ptr A, const size_t lda) {
+            FFLAS::finit(F,n,v,1);
+            FFLAS::finit(F,m,w,1);
+            FFLAS::frand(F,G,n,v,1);
+
+            // w <- A.v
+            FFLAS::fgemv(F, FFLAS::FflasNoTrans, m, n, F.one, A, lda, v, 1, F.zero, w, 1);
+        }
+    };
+}
+
+#endif // __FFLASFFPACK_checker_echelon_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
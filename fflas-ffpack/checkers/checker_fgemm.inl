@@ -27,6 +27,8 @@
 #ifndef __FFLASFFPACK_checker_fgemm_INL
 #define __FFLASFFPACK_checker_fgemm_INL
 
+#include "checker_batch.inl"
+
 namespace FFLAS {
 
     template <class Field>
@@ -101,6 +103,86 @@ namespace FFLAS {
         }
 
     };
+
+    /** Batched verification of fgemm.
+     *
+     * @code
+     *   CheckerBatch_fgemm<Field> batch (F, 1e-9, true);
+     *   for (...) {
+     *       auto t = batch.prepare (m, n, k, beta, C, ldc);
+     *       fgemm (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+     *       batch.record (t, ta, tb, m, n, k, alpha, A, lda, B, ldb, C, ldc);
+     *   }
+     *   batch.check (); // throws FailureFgemmCheck
+     * @endcode
+     */
+    template <class Field>
+    class CheckerBatch_fgemm : public CheckerBatch<Field> {
+        typedef CheckerBatch<Field> Base;
+        using Base::F;
+
+    public:
+        typedef typename Base::Ticket Ticket;
+
+        /// @param errorBound probability for a wrong result to pass the check
+        /// @param async whether the verifications run on a background thread
+        CheckerBatch_fgemm (const Field& F_, double errorBound = 1e-9, bool async = false, uint64_t seed = 0) :
+            Base (F_, errorBound, async, seed) {}
+
+        ~CheckerBatch_fgemm () { this->wait(); }
+
+        /// To be called before the product: accumulates - beta.C.V
+        Ticket prepare (const size_t m, const size_t n, const size_t /*k*/,
+                        const typename Field::Element beta,
+                        typename Field::ConstElement_ptr C, const size_t ldc)
+        {
+            Ticket tk = this->newTicket();
+            if (F.isZero (beta) || !m || !n) return tk;
+            std::lock_guard<std::mutex> lock (this->_mtx);
+            const size_t t = this->projections();
+            typename Field::Element_ptr W = this->scratchW (m);
+            FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m, t, n, beta, C, ldc, this->projection (n), t, F.zero, W, t);
+            this->accumulate (tk, true, m, W);
+            return tk;
+        }
+
+        /// To be called after the product: accumulates (C - alpha.A.B).V
+        void record (const Ticket& tk,
+                     const FFLAS::FFLAS_TRANSPOSE ta, const FFLAS::FFLAS_TRANSPOSE tb,
+                     const size_t m, const size_t n, const size_t k,
+                     const typename Field::Element alpha,
+                     typename Field::ConstElement_ptr A, const size_t lda,
+                     typename Field::ConstElement_ptr B, const size_t ldb,
+                     typename Field::ConstElement_ptr C, const size_t ldc)
+        {
+            if (!m || !n) return;
+            this->submit ([=]() {
+                std::lock_guard<std::mutex> lock (this->_mtx);
+                const size_t t = this->projections();
+                typename Field::ConstElement_ptr V = this->projection (n);
+                typename Field::Element_ptr W = this->scratchW (m);
+                // W <- C.V
+                FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m, t, n, F.one, C, ldc, V, t, F.zero, W, t);
+                if (k) {
+                    // T <- B.V
+                    typename Field::Element_ptr T = this->scratchT (k);
+                    FFLAS::fgemm (F, tb, FFLAS::FflasNoTrans, k, t, n, F.one, B, ldb, V, t, F.zero, T, t);
+                    // W <- W - alpha.A.T
+                    typename Field::Element malpha; F.neg (malpha, alpha);
+                    FFLAS::fgemm (F, ta, FFLAS::FflasNoTrans, m, t, k, malpha, A, lda, T, t, F.one, W, t);
+                }
+                this->accumulate (tk, false, m, W);
+            });
+        }
+
+        /// Tests all the products recorded since the last check
+        bool check ()
+        {
+            bool pass = this->verify();
+            if (!pass) throw FailureFgemmCheck();
+            return pass;
+        }
+    };
 }
 #endif // __FFLASFFPACK_checker_fgemm_INL
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
@@ -0,0 +1,122 @@
+/* checkers/checker_fgesv.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_fgesv_INL
+#define __FFLASFFPACK_checker_fgesv_INL
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK {
+
+    /** Checker of the solutions of A.X = B (Side = FflasLeft) or X.A = B (Side = FflasRight)
+     * computed by fgesv or Solve, A being m x n.
+     * As the input A and B are overwritten, the projections u^T.A, u^T.B (resp. A.v, B.v)
+     * are computed at construction and checked against u^T.A.X (resp. X.A.v) afterwards.
+     */
+    template <class Field>
+    class CheckerImplem_fgesv {
+
+        const Field& F;
+        const FFLAS::FFLAS_SIDE Side;
+        const size_t m,n,nrhs;
+        typename Field::Element_ptr y,z;
+
+    public:
+        /**
+         * @param Side FflasLeft for A.X = B, FflasRight for X.A = B
+         * @param m row dimension of A
+         * @param n column dimension of A
+         * @param nrhs number of columns (FflasLeft) or rows (FflasRight) of B
+         */
+        CheckerImplem_fgesv(const Field& F_, const FFLAS::FFLAS_SIDE Side_,
+                            const size_t m_, const size_t n_, const size_t nrhs_,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb)
+        : F(F_), Side(Side_), m(m_), n(n_), nrhs(nrhs_),
+        y(FFLAS::fflas_new(F_,(Side_==FFLAS::FflasLeft)?n_:m_)), z(FFLAS::fflas_new(F_,nrhs_))
+        {
+            typename Field::RandIter G(F);
+            init(G,A,lda,B,ldb);
+        }
+
+        CheckerImplem_fgesv(typename Field::RandIter &G, const FFLAS::FFLAS_SIDE Side_,
+                            const size_t m_, const size_t n_, const size_t nrhs_,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb)
+        : F(G.ring()), Side(Side_), m(m_), n(n_), nrhs(nrhs_),
+        y(FFLAS::fflas_new(F,(Side_==FFLAS::FflasLeft)?n_:m_)), z(FFLAS::fflas_new(F,nrhs_))
+        {
+            init(G,A,lda,B,ldb);
+        }
+
+        ~CheckerImplem_fgesv() {
+            FFLAS::fflas_delete(y,z);
+        }
+
+        /** check if the solution is correct.
+         * An inconsistent system (info > 0) is not certified.
+         * @param X the solution: n x nrhs (FflasLeft) or nrhs x m (FflasRight)
+         * @param ldx
+         * @param info the status returned by the solver
+         */
+        inline bool check(typename Field::ConstElement_ptr X, const size_t ldx, const int info) const {
+            if (info > 0) return true;
+            typename Field::Element_ptr t = FFLAS::fflas_new(F,nrhs);
+            // t <- X^T.(A^T.u) (resp. X.(A.v))
+            if (Side == FFLAS::FflasLeft)
+                FFLAS::fgemv(F, FFLAS::FflasTrans, n, nrhs, F.one, X, ldx, y, 1, F.zero, t, 1);
+            else
+                FFLAS::fgemv(F, FFLAS::FflasNoTrans, nrhs, m, F.one, X, ldx, y, 1, F.zero, t, 1);
+
+            // is t == z ?
+            bool pass = FFLAS::fequal(F, nrhs, t, 1, z, 1);
+            FFLAS::fflas_delete(t);
+            if (!pass) throw FailureFgesvCheck();
+            return pass;
+        }
+
+    private:
+        inline void init(typename Field::RandIter &G,
+                         typename Field::ConstElement_ptr A, const size_t lda,
+                         typename Field::ConstElement_ptr B, const size_t ldb) {
+            const size_t k = (Side == FFLAS::FflasLeft) ? m : n;
+            typename Field::Element_ptr u = FFLAS::fflas_new(F,k);
+            FFLAS::finit(F,k,u,1);
+            FFLAS::frand(F,G,k,u,1);
+            if (Side == FFLAS::FflasLeft){
+                // y <- A^T.u, z <- B^T.u
+                FFLAS::fgemv(F, FFLAS::FflasTrans, m, n, F.one, A, lda, u, 1, F.zero, y, 1);
+                FFLAS::fgemv(F, FFLAS::FflasTrans, m, nrhs, F.one, B, ldb, u, 1, F.zero, z, 1);
+            } else {
+                // y <- A.v, z <- B.v
+                FFLAS::fgemv(F, FFLAS::FflasNoTrans, m, n, F.one, A, lda, u, 1, F.zero, y, 1);
+                FFLAS::fgemv(F, FFLAS::FflasNoTrans, nrhs, n, F.one, B, ldb, u, 1, F.zero, z, 1);
+            }
+            FFLAS::fflas_delete(u);
+        }
+    };
+}
+
+#endif // __FFLASFFPACK_checker_fgesv_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
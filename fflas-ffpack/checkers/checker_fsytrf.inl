@@ -0,0 +1,111 @@
+/* checkers/checker_fsytrf.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_fsytrf_INL
+#define __FFLASFFPACK_checker_fsytrf_INL
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK {
+
+    /** Checker of the symmetric factorizations A = L.D.L^T or A = U^T.D.U computed by fsytrf.
+     * Only the triangle UpLo of A is read, as fsytrf does.
+     */
+    template <class Field>
+    class CheckerImplem_fsytrf {
+
+        const Field& F;
+        typename Field::Element_ptr v,w;
+        const size_t n;
+        const FFLAS::FFLAS_UPLO UpLo;
+
+    public:
+        CheckerImplem_fsytrf(const Field& F_, const FFLAS::FFLAS_UPLO UpLo_, const size_t n_,
+                             typename Field::ConstElement_ptr A, const size_t lda)
+        : F(F_), v(FFLAS::fflas_new(F_,n_)), w(FFLAS::fflas_new(F_,n_)), n(n_), UpLo(UpLo_)
+        {
+            typename Field::RandIter G(F);
+            init(G,A,lda);
+        }
+
+        CheckerImplem_fsytrf(typename Field::RandIter &G, const FFLAS::FFLAS_UPLO UpLo_, const size_t n_,
+                             typename Field::ConstElement_ptr A, const size_t lda)
+        : F(G.ring()), v(FFLAS::fflas_new(F,n_)), w(FFLAS::fflas_new(F,n_)), n(n_), UpLo(UpLo_)
+        {
+            init(G,A,lda);
+        }
+
+        ~CheckerImplem_fsytrf() {
+            FFLAS::fflas_delete(v,w);
+        }
+
+        /** check if the factorization is correct.
+         *  Returns true if w == U^T.D.U.v (resp. L.D.L^T.v).
+         *  A failed factorization (no generic rank profile) is not certified.
+         * @param A the factorization: D on the diagonal, U (resp. L) unit triangular
+         * @param lda
+         * @param success the value returned by fsytrf
+         */
+        inline bool check(typename Field::ConstElement_ptr A, const size_t lda, const bool success) const {
+            if (!success) return true;
+            const FFLAS::FFLAS_TRANSPOSE first = (UpLo == FFLAS::FflasUpper) ? FFLAS::FflasNoTrans : FFLAS::FflasTrans;
+            const FFLAS::FFLAS_TRANSPOSE second = (UpLo == FFLAS::FflasUpper) ? FFLAS::FflasTrans : FFLAS::FflasNoTrans;
+            typename Field::Element_ptr x = FFLAS::fflas_new(F,n);
+            FFLAS::fassign(F, n, v, 1, x, 1);
+
+            // x <- D.U.v (resp. D.L^T.v)
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, UpLo, first, FFLAS::FflasUnit, n, 1, F.one, A, lda, x, 1);
+            for (size_t i=0; i<n; ++i)
+                F.mulin(x[i], A[i*(lda+1)]);
+            // x <- U^T.x (resp. L.x)
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, UpLo, second, FFLAS::FflasUnit, n, 1, F.one, A, lda, x, 1);
+
+            bool pass = FFLAS::fequal(F, n, w, 1, x, 1);
+            FFLAS::fflas_delete(x);
+            if (!pass) throw FailureFsytrfCheck();
+            return pass;
+        }
+
+    private:
+        inline void init(typename Field::RandIter &G, typename Field::ConstElement_ptr A, const size_t lda) {
+            FFLAS::finit(F,n,v,1);
+            FFLAS::finit(F,n,w,1);
+            FFLAS::frand(F,G,n,v,1);
+
+            // w <- A.v = T.v + (T-Diag(T))^T.v, T being the stored triangle of A
+            typename Field::Element_ptr x = FFLAS::fflas_new(F,n);
+            FFLAS::fassign(F, n, v, 1, w, 1);
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, UpLo, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, n, 1, F.one, A, lda, w, 1);
+            FFLAS::fassign(F, n, v, 1, x, 1);
+            // x <- (T-Diag(T)+I)^T.v, the extra v is removed below
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, UpLo, FFLAS::FflasTrans, FFLAS::FflasUnit, n, 1, F.one, A, lda, x, 1);
+            FFLAS::faddin(F, n, x, 1, w, 1);
+            FFLAS::fsubin(F, n, v, 1, w, 1);
+            FFLAS::fflas_delete(x);
+        }
+    };
+}
+
+#endif // __FFLASFFPACK_checker_fsytrf_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,94 @@
+/* checkers/checker_minpoly.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_minpoly_INL
+#define __FFLASFFPACK_checker_minpoly_INL
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK {
+
+    /** Checker of the minimal polynomial computed by MinPoly.
+     * MinPoly returns the minimal polynomial g of a Krylov sequence of A, a divisor of the
+     * minimal polynomial of A: both are equal if and only if g(A) = 0, which is checked
+     * on an independent random vector w by a Horner evaluation of g(A).w.
+     * This costs deg(g) matrix-vector products, and no extra storage of A: about as much as the
+     * Krylov sequence built by MinPoly, not the O(n^2) of the other checkers. Hence it is not
+     * turned on by ENABLE_ALL_CHECKINGS, but only by ENABLE_CHECKER_minpoly.
+     */
+    template <class Field, class Polynomial>
+    class CheckerImplem_minpoly {
+
+        const Field& F;
+        const size_t n, lda;
+        typename Field::ConstElement_ptr A;
+        typename Field::Element_ptr w;
+
+    public:
+        CheckerImplem_minpoly(const Field& F_, const size_t n_, typename Field::ConstElement_ptr A_, const size_t lda_)
+        : F(F_), n(n_), lda(lda_), A(A_), w(FFLAS::fflas_new(F_,n_))
+        {
+            typename Field::RandIter G(F);
+            init(G);
+        }
+
+        CheckerImplem_minpoly(typename Field::RandIter &G, const size_t n_, typename Field::ConstElement_ptr A_, const size_t lda_)
+        : F(G.ring()), n(n_), lda(lda_), A(A_), w(FFLAS::fflas_new(F,n_))
+        {
+            init(G);
+        }
+
+        ~CheckerImplem_minpoly() {
+            FFLAS::fflas_delete(w);
+        }
+
+        inline bool check(const Polynomial &g) const {
+            bool pass = (g.size() > 0) && (g.size() <= n+1) && F.isOne(g[g.size()-1]);
+            if (pass && n){
+                typename Field::Element_ptr x = FFLAS::fflas_new(F,n);
+                typename Field::Element_ptr y = FFLAS::fflas_new(F,n);
+                // x <- g(A).w by Horner
+                FFLAS::fzero(F, n, x, 1);
+                for (size_t i=g.size(); i--; ){
+                    FFLAS::fassign(F, n, w, 1, y, 1);
+                    FFLAS::fgemv(F, FFLAS::FflasNoTrans, n, n, F.one, A, lda, x, 1, g[i], y, 1);
+                    std::swap(x,y);
+                }
+                pass = FFLAS::fiszero(F, n, x, 1);
+                FFLAS::fflas_delete(x,y);
+            }
+            if (!pass) throw FailureMinpolyCheck();
+            return pass;
+        }
+
+    private:
+        inline void init(typename Field::RandIter &G) {
+            FFLAS::finit(F,n,w,1);
+            FFLAS::frand(F,G,n,w,1);
+        }
+    };
+}
+
+#endif // __FFLASFFPACK_checker_minpoly_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
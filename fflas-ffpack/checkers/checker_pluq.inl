@@ -29,6 +29,7 @@
 
 #include "fflas-ffpack/ffpack/ffpack.h"
 #include "fflas-ffpack/utils/fflas_io.h"
+#include "checker_batch.inl"
 
 #ifdef TIME_CHECKER_PLUQ
 #include <givaro/givtimer.h>
@@ -145,6 +146,84 @@ namespace FFPACK {
 #endif
         }
     };
+
+    /** Batched verification of PLUQ.
+     *
+     * @code
+     *   CheckerBatch_PLUQ<Field> batch (F, 1e-9, true);
+     *   auto t = batch.prepare (m, n, A, lda);
+     *   r = PLUQ (F, Diag, m, n, A, lda, P, Q);
+     *   batch.record (t, m, n, A, lda, Diag, r, P, Q);
+     *   ...
+     *   batch.check (); // throws FailurePLUQCheck
+     * @endcode
+     */
+    template <class Field>
+    class CheckerBatch_PLUQ : public FFLAS::CheckerBatch<Field> {
+        typedef FFLAS::CheckerBatch<Field> Base;
+        using Base::F;
+
+    public:
+        typedef typename Base::Ticket Ticket;
+
+        /// @param errorBound probability for a wrong factorization to pass the check
+        /// @param async whether the verifications run on a background thread
+        CheckerBatch_PLUQ (const Field& F_, double errorBound = 1e-9, bool async = false, uint64_t seed = 0) :
+            Base (F_, errorBound, async, seed) {}
+
+        ~CheckerBatch_PLUQ () { this->wait(); }
+
+        /// To be called before the factorization: accumulates - A.V
+        Ticket prepare (const size_t m, const size_t n, typename Field::ConstElement_ptr A, const size_t lda)
+        {
+            Ticket tk = this->newTicket();
+            if (!m || !n) return tk;
+            std::lock_guard<std::mutex> lock (this->_mtx);
+            const size_t t = this->projections();
+            typename Field::Element_ptr W = this->scratchW (m);
+            FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m, t, n, F.one, A, lda, this->projection (n), t, F.zero, W, t);
+            this->accumulate (tk, true, m, W);
+            return tk;
+        }
+
+        /// To be called after the factorization: accumulates P.L.U.Q.V
+        void record (const Ticket& tk, const size_t m, const size_t n,
+                     typename Field::ConstElement_ptr A, const size_t lda,
+                     const FFLAS::FFLAS_DIAG Diag, const size_t r,
+                     const size_t* P, const size_t* Q)
+        {
+            if (!m || !n) return;
+            this->submit ([=]() {
+                std::lock_guard<std::mutex> lock (this->_mtx);
+                const size_t t = this->projections();
+                typename Field::Element_ptr W = this->scratchW (std::max (m,n));
+                // W <- Q.V
+                FFLAS::fassign (F, n, t, this->projection (n), t, W, t);
+                FFPACK::applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, t, 0, n, W, t, Q);
+                // W1 <- U1.W1 + U2.W2
+                FFLAS::ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, Diag, r, t, F.one, A, lda, W, t);
+                if (r < n)
+                    FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, t, n-r, F.one, A+r, lda, W+r*t, t, F.one, W, t);
+                // W2 <- L2.W1
+                if (r < m)
+                    FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-r, t, r, F.one, A+r*lda, lda, W, t, F.zero, W+r*t, t);
+                // W1 <- L1.W1
+                const FFLAS::FFLAS_DIAG oppDiag = (Diag == FFLAS::FflasNonUnit) ? FFLAS::FflasUnit : FFLAS::FflasNonUnit;
+                FFLAS::ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, oppDiag, r, t, F.one, A, lda, W, t);
+                // W <- P.W
+                FFPACK::applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, t, 0, m, W, t, P);
+                this->accumulate (tk, false, m, W);
+            });
+        }
+
+        /// Tests all the factorizations recorded since the last check
+        bool check ()
+        {
+            bool pass = this->verify();
+            if (!pass) throw FailurePLUQCheck();
+            return pass;
+        }
+    };
 }
 #endif // __FFLASFFPACK_checker_pluq_INL
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
@@ -0,0 +1,213 @@
+/* checkers/checker_rankprofile.inl
+ * Copyright (C) 2016 FFLAS-FFPACK
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_checker_rankprofile_INL
+#define __FFLASFFPACK_checker_rankprofile_INL
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK {
+
+    /** Checker of the row and column rank profiles computed by RowRankProfile and ColumnRankProfile.
+     *
+     * The factorization A = L.U of inner dimension r behind the profile is checked by applying its
+     * compact storage to a random projection, and the r pivots are checked to be non zero: this
+     * certifies the rank. The profile is certified by the shape of the factor it is read from:
+     *  - with FfpackSlabRecursive (CUP or PLE), L (resp. U) is applied as an echelon form whose
+     *    pivots are the claimed profile, so that a row (resp. column) of A outside the profile is
+     *    a combination of the rows (resp. columns) of the profile preceding it;
+     *  - with FfpackTileRecursive (PLUQ), the entries of L (resp. U) that would combine a row
+     *    (resp. column) of A with a later one are checked to be zero, i.e. P [L 0] P^T is lower
+     *    triangular (resp. Q^T [U 0]^T Q upper triangular), and the claimed profile is the one
+     *    of the pivots.
+     */
+    template <class Field>
+    class CheckerImplem_rankprofile {
+
+        const Field& F;
+        typename Field::Element_ptr v,w;
+        const size_t m,n;
+        const bool column;
+
+    public:
+        /**
+         * @param column false for a row rank profile, true for a column rank profile
+         */
+        CheckerImplem_rankprofile(const Field& F_, const size_t m_, const size_t n_,
+                                  typename Field::ConstElement_ptr A, const size_t lda, const bool column_)
+        : F(F_), v(FFLAS::fflas_new(F_,n_)), w(FFLAS::fflas_new(F_,m_)), m(m_), n(n_), column(column_)
+        {
+            typename Field::RandIter G(F);
+            init(G,A,lda);
+        }
+
+        CheckerImplem_rankprofile(typename Field::RandIter &G, const size_t m_, const size_t n_,
+                                  typename Field::ConstElement_ptr A, const size_t lda, const bool column_)
+        : F(G.ring()), v(FFLAS::fflas_new(F,n_)), w(FFLAS::fflas_new(F,m_)), m(m_), n(n_), column(column_)
+        {
+            init(G,A,lda);
+        }
+
+        ~CheckerImplem_rankprofile() {
+            FFLAS::fflas_delete(v,w);
+        }
+
+        /** check if the rank profile is correct.
+         * @param A the compact storage of the factorization, with a non unit diagonal in U (resp. L for PLE)
+         * @param lda
+         * @param r the rank
+         * @param P the first permutation returned by LUdivine or PLUQ
+         * @param Q the second permutation returned by LUdivine or PLUQ
+         * @param rkprofile the rank profile
+         * @param LuTag the elimination algorithm used
+         */
+        inline bool check(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                          const size_t* P, const size_t* Q, const size_t* rkprofile,
+                          const FFPACK_LU_TAG LuTag) const {
+            const size_t dim = column ? n : m;
+            bool pass = (r <= std::min(m,n));
+            for (size_t i=0; pass && i<r; ++i)
+                pass = !F.isZero(A[i*(lda+1)])
+                       && rkprofile[i] < dim && (!i || rkprofile[i] > rkprofile[i-1]);
+            if (pass && m && n){
+                if (LuTag == FfpackSlabRecursive)
+                    pass = column ? checkPLE(A, lda, r, P, rkprofile) : checkCUP(A, lda, r, P, rkprofile);
+                else
+                    pass = checkPivots(A, lda, r, column ? Q : P, rkprofile) && checkPLUQ(A, lda, r, P, Q);
+            }
+            if (!pass) throw FailureRankProfileCheck();
+            return pass;
+        }
+
+    private:
+        // A = L.U.P with L in column echelon form with pivots rkprofile (unit) and U upper trapezoidal.
+        // Checks that L.(U.(P.v)) == A.v
+        inline bool checkCUP(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                             const size_t* P, const size_t* rkprofile) const {
+            typename Field::Element_ptr _w = FFLAS::fflas_new(F,std::max(m,n));
+            FFLAS::fassign(F, n, v, 1, _w, 1);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, r, _w, 1, P);
+            // w1 <- U1.w1 + U2.w2
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, 1, F.one, A, lda, _w, 1);
+            if (r < n)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, 1, n-r, F.one, A+r, lda, _w+r, 1, F.one, _w, 1);
+            // w <- L.w1, bottom up: row i only involves the k <= i columns whose pivot is above it
+            size_t k = r;
+            for (size_t i = m; i-- > 0; ){
+                while (k && rkprofile[k-1] >= i) --k;
+                typename Field::Element t;
+                F.init(t);
+                if (k < r && rkprofile[k] == i)
+                    F.assign(t, _w[k]);
+                F.addin(t, FFLAS::fdot(F, k, A+i*lda, 1, _w, 1));
+                F.assign(_w[i], t);
+            }
+            bool pass = FFLAS::fequal(F, m, w, 1, _w, 1);
+            FFLAS::fflas_delete(_w);
+            return pass;
+        }
+
+        // A = P.L.E with L lower trapezoidal and E in row echelon form with pivots rkprofile (unit).
+        // Checks that P.(L.(E.v)) == A.v
+        inline bool checkPLE(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                             const size_t* P, const size_t* rkprofile) const {
+            typename Field::Element_ptr _w = FFLAS::fflas_new(F,std::max(m,n));
+            FFLAS::fassign(F, n, v, 1, _w, 1);
+            // w1 <- E.w, top down: row i only involves the columns from its pivot rkprofile[i] >= i
+            for (size_t i = 0; i < r; ++i){
+                const size_t piv = rkprofile[i];
+                typename Field::Element t;
+                F.init(t);
+                F.assign(t, _w[piv]);
+                F.addin(t, FFLAS::fdot(F, n-piv-1, A+i*lda+piv+1, 1, _w+piv+1, 1));
+                F.assign(_w[i], t);
+            }
+            // w2 <- L2.w1, w1 <- L1.w1
+            if (r < m)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-r, 1, r, F.one, A+r*lda, lda, _w, 1, F.zero, _w+r, 1);
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, 1, F.one, A, lda, _w, 1);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasTrans, 1, 0, r, _w, 1, P);
+            bool pass = FFLAS::fequal(F, m, w, 1, _w, 1);
+            FFLAS::fflas_delete(_w);
+            return pass;
+        }
+
+        // Checks that the profile is the one of the pivots given by Perm (P for rows, Q for columns)
+        // and that no entry of L (resp. U) combines a row (resp. column) of A with a later one
+        inline bool checkPivots(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                                const size_t* Perm, const size_t* rkprofile) const {
+            const size_t dim = column ? n : m;
+            // RP[i]: the row (resp. column) of A moved to position i by Perm
+            size_t* RP = FFLAS::fflas_new<size_t>(dim);
+            for (size_t i=0; i<dim; ++i)
+                RP[i] = i;
+            for (size_t i=0; i<dim; ++i)
+                if (Perm[i] != i)
+                    std::swap(RP[i], RP[Perm[i]]);
+            bool pass = true;
+            for (size_t j=0; pass && j<r; ++j)
+                for (size_t i=j+1; pass && i<dim; ++i)
+                    if (RP[i] < RP[j])
+                        pass = F.isZero(column ? A[j*lda+i] : A[i*lda+j]);
+            if (pass){
+                std::sort(RP, RP+r);
+                pass = std::equal(rkprofile, rkprofile+r, RP);
+            }
+            FFLAS::fflas_delete(RP);
+            return pass;
+        }
+
+        // A = P.L.U.Q: checks that P.(L.(U.(Q.v))) == A.v as CheckerImplem_PLUQ
+        inline bool checkPLUQ(typename Field::ConstElement_ptr A, const size_t lda, const size_t r,
+                              const size_t* P, const size_t* Q) const {
+            typename Field::Element_ptr _w = FFLAS::fflas_new(F,std::max(m,n));
+            FFLAS::fassign(F, n, v, 1, _w, 1);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, 1, 0, n, _w, 1, Q);
+            // w1 <- U1.w1 + U2.w2
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, 1, F.one, A, lda, _w, 1);
+            if (r < n)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, 1, n-r, F.one, A+r, lda, _w+r, 1, F.one, _w, 1);
+            // w2 <- L2.w1, w1 <- L1.w1
+            if (r < m)
+                FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-r, 1, r, F.one, A+r*lda, lda, _w, 1, F.zero, _w+r, 1);
+            FFLAS::ftrmm(F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, 1, F.one, A, lda, _w, 1);
+            applyP(F, FFLAS::FflasLeft, FFLAS::FflasTrans, 1, 0, m, _w, 1, P);
+            bool pass = FFLAS::fequal(F, m, w, 1, _w, 1);
+            FFLAS::fflas_delete(_w);
+            return pass;
+        }
+
+        inline void init(typename Field::RandIter &G, typename Field::ConstElement_ptr A, const size_t lda) {
+            FFLAS::finit(F,n,v,1);
+            FFLAS::finit(F,m,w,1);
+            FFLAS::frand(F,G,n,v,1);
+
+            // w <- A.v
+            FFLAS::fgemv(F, FFLAS::FflasNoTrans, m, n, F.one, A, lda, v, 1, F.zero, w, 1);
+        }
+    };
+}
+
+#endif // __FFLASFFPACK_checker_rankprofile_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -41,6 +41,11 @@
 #define ENABLE_CHECKER_Det 1
 #define ENABLE_CHECKER_invert 1
 #define ENABLE_CHECKER_charpoly 1
+#define ENABLE_CHECKER_fsytrf 1
+#define ENABLE_CHECKER_fgesv 1
+#define ENABLE_CHECKER_echelon 1
+#define ENABLE_CHECKER_rankprofile 1
+// the MinPoly checker costs about as much as MinPoly: it is only enabled on its own
 #endif
 
 #ifdef TIME_CHECKERS
@@ -57,12 +62,22 @@ class FailurePLUQCheck {};
 class FailureDetCheck {};
 class FailureInvertCheck {};
 class FailureCharpolyCheck {};
+class FailureFsytrfCheck {};
+class FailureFgesvCheck {};
+class FailureEchelonCheck {};
+class FailureRankProfileCheck {};
+class FailureMinpolyCheck {};
 
 namespace FFPACK {
     template <class Field> class CheckerImplem_PLUQ;
     template <class Field> class CheckerImplem_Det;
     template <class Field> class CheckerImplem_invert;
     template <class Field, class Polynomial> class CheckerImplem_charpoly;
+    template <class Field> class CheckerImplem_fsytrf;
+    template <class Field> class CheckerImplem_fgesv;
+    template <class Field> class CheckerImplem_echelon;
+    template <class Field> class CheckerImplem_rankprofile;
+    template <class Field, class Polynomial> class CheckerImplem_minpoly;
 }
 
 
@@ -90,6 +105,36 @@ namespace FFPACK {
 #else
     template <class Field, class Polynomial> using Checker_charpoly = FFLAS::Checker_Empty<Field>;
 #endif
+
+#ifdef ENABLE_CHECKER_fsytrf
+    template <class Field> using Checker_fsytrf = CheckerImplem_fsytrf<Field>;
+#else
+    template <class Field> using Checker_fsytrf = FFLAS::Checker_Empty<Field>;
+#endif
+
+#ifdef ENABLE_CHECKER_fgesv
+    template <class Field> using Checker_fgesv = CheckerImplem_fgesv<Field>;
+#else
+    template <class Field> using Checker_fgesv = FFLAS::Checker_Empty<Field>;
+#endif
+
+#ifdef ENABLE_CHECKER_echelon
+    template <class Field> using Checker_echelon = CheckerImplem_echelon<Field>;
+#else
+    template <class Field> using Checker_echelon = FFLAS::Checker_Empty<Field>;
+#endif
+
+#ifdef ENABLE_CHECKER_rankprofile
+    template <class Field> using Checker_rankprofile = CheckerImplem_rankprofile<Field>;
+#else
+    template <class Field> using Checker_rankprofile = FFLAS::Checker_Empty<Field>;
+#endif
+
+#ifdef ENABLE_CHECKER_minpoly
+    template <class Field, class Polynomial> using Checker_minpoly = CheckerImplem_minpoly<Field,Polynomial>;
+#else
+    template <class Field, class Polynomial> using Checker_minpoly = FFLAS::Checker_Empty<Field>;
+#endif
 }
 
 #include "fflas-ffpack/ffpack/ffpack.h"
@@ -31,12 +31,22 @@
 #include "checker_det.inl"
 #include "checker_invert.inl"
 #include "checker_charpoly.inl"
+#include "checker_fsytrf.inl"
+#include "checker_fgesv.inl"
+#include "checker_echelon.inl"
+#include "checker_rankprofile.inl"
+#include "checker_minpoly.inl"
 
 namespace FFPACK {
     template <class Field> using ForceCheck_PLUQ = CheckerImplem_PLUQ<Field>;
     template <class Field> using ForceCheck_Det = CheckerImplem_Det<Field>;
     template <class Field> using ForceCheck_invert = CheckerImplem_invert<Field>;
     template <class Field, class Polynomial> using ForceCheck_charpoly = CheckerImplem_charpoly<Field,Polynomial>;
+    template <class Field> using ForceCheck_fsytrf = CheckerImplem_fsytrf<Field>;
+    template <class Field> using ForceCheck_fgesv = CheckerImplem_fgesv<Field>;
+    template <class Field> using ForceCheck_echelon = CheckerImplem_echelon<Field>;
+    template <class Field> using ForceCheck_rankprofile = CheckerImplem_rankprofile<Field>;
+    template <class Field, class Polynomial> using ForceCheck_minpoly = CheckerImplem_minpoly<Field,Polynomial>;
 }
 
 #endif
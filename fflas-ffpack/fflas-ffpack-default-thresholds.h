@@ -34,10 +34,21 @@
 #define __FFLASFFPACK_ARITHPROG_THRESHOLD 30
 #endif
 
+// Decision table of CharPoly with FfpackAuto: {field kind, max bitsize of p, max n, variant}
+// entries, 0 meaning any, set by autotune/charpoly-auto.C. When no entry applies, Danilevski is
+// used below the degree argument of CharPoly, then LUKrylov up to the threshold above, then ArithProg.
+#ifndef __FFLASFFPACK_CHARPOLY_AUTO_TABLE
+#define __FFLASFFPACK_CHARPOLY_AUTO_TABLE {{0,0,0,0}}
+#endif
+
 #ifndef __FFLASFFPACK_FTRTRI_THRESHOLD
 #define __FFLASFFPACK_FTRTRI_THRESHOLD 32
 #endif
 
+#ifndef __FFLASFFPACK_FTRTRM_THRESHOLD
+#define __FFLASFFPACK_FTRTRM_THRESHOLD 32
+#endif
+
 #ifndef __FFLASFFPACK_FSYTRF_THRESHOLD
 #define __FFLASFFPACK_FSYTRF_THRESHOLD 64
 #endif
@@ -45,5 +56,42 @@
 #ifndef __FFLASFFPACK_FSYRK_THRESHOLD
 #define __FFLASFFPACK_FSYRK_THRESHOLD 3000
 #endif
+
+// Size in bytes of the blocks of C, op(A) and op(B) widened together from an integer to a floating
+// point representation by fgemm, unless raised to the Winograd threshold for large products (see
+// FFLAS::Protected::fgemm_convert)
+#ifndef __FFLASFFPACK_CONVERT_PANEL_BYTES
+#define __FFLASFFPACK_CONVERT_PANEL_BYTES 8388608
+#endif
+
+// Blocking of igemm: 0 selects the cache size heuristic of FFLAS::details::BlockingFactor
+#ifndef __FFLASFFPACK_IGEMM_MC
+#define __FFLASFFPACK_IGEMM_MC 0
+#endif
+
+#ifndef __FFLASFFPACK_IGEMM_KC
+#define __FFLASFFPACK_IGEMM_KC 0
+#endif
+
+#ifndef __FFLASFFPACK_IGEMM_NC
+#define __FFLASFFPACK_IGEMM_NC 0
+#endif
+
+// Number of simd vectors (1 or 2) in the rows of the igemm micro-kernel
+#ifndef __FFLASFFPACK_IGEMM_MR_VECTORS
+#define __FFLASFFPACK_IGEMM_MR_VECTORS 2
+#endif
+
+// Smallest dimension from which PLUQ and Rank over a field of cardinality 2 switch to
+// the bit packed routines of ffpack_gf2.inl (tuned by autotune/gf2.C)
+#ifndef __FFLASFFPACK_GF2_THRESHOLD
+#define __FFLASFFPACK_GF2_THRESHOLD 32
+#endif
+
+// Smallest dimension from which fgemm over a field of cardinality 2 switches to the bit packed
+// fgemm of fflas_gf2.inl (tuned by autotune/gf2.C)
+#ifndef __FFLASFFPACK_GF2_FGEMM_THRESHOLD
+#define __FFLASFFPACK_GF2_FGEMM_THRESHOLD 32
+#endif
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
 // vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
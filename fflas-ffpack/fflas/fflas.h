@@ -68,6 +68,7 @@
 
 #include "fflas-ffpack/utils/fflas_memory.h"
 #include "fflas-ffpack/paladin/parallel.h"
+#include "fflas-ffpack/utils/instrumentation.h"
 
 //---------------------------------------------------------------------
 // Level 1 routines
@@ -104,6 +105,7 @@
 #include "fflas_fscal.h"
 #include "fflas_fassign.h"
 
+#include "fflas_gf2.inl"
 #include "fflas_fgemm.inl"
 #include "fflas_pfgemm.inl"
 // fgemm must be before fgemv according to ScalAndReduce function declaration ?!? PG
@@ -117,6 +119,7 @@
 #include "fflas_ftrsm.inl"
 #include "fflas_pftrsm.inl"
 #include "fflas_ftrmm.inl"
+#include "fflas_pftrmm.inl"
 #include "fflas_ftrsv.inl"
 #include "fflas_faxpy.inl"
 #include "fflas_fdot.inl"
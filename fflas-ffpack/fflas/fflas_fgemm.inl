@@ -35,6 +35,9 @@
 
 namespace FFLAS { namespace Protected{
 
+    template<class Field>
+    inline int WinogradThreshold (const Field& F);
+
     template <class NewField, class Field, class FieldMode>
     inline typename Field::Element_ptr
     fgemm_convert (const Field& F,
@@ -53,6 +56,11 @@ namespace FFLAS { namespace Protected{
         // FFLASFFPACK_check(lda);
         // FFLASFFPACK_check(ldb);
         // FFLASFFPACK_check(ldc);
+        if (!m || !n) return C;
+        if (!k){
+            fscalin (F, m, n, beta, C, ldc);
+            return C;
+        }
         typedef typename NewField::Element FloatElement;
         NewField G((FloatElement) F.characteristic());
         FloatElement tmp,alphaf, betaf;
@@ -63,30 +71,59 @@ namespace FFLAS { namespace Protected{
         F.convert (tmp, alpha);
         G.init(alphaf, tmp);
 
-        FloatElement* Af = FFLAS::fflas_new(G, m, k);
-        FloatElement* Bf = FFLAS::fflas_new(G, k, n);
-        FloatElement* Cf = FFLAS::fflas_new(G, m, n);
-
-        size_t ma, ka, kb, nb; //mb, na
-        if (ta == FflasTrans) { ma = k; ka = m; }
-        else { ma = m; ka = k; }
-        if (tb == FflasTrans) { kb = n; nb = k; }
-        else {  kb = k; nb = n; }
-        size_t ldaf = ka, ldbf = nb, ldcf= n;
-
-        fconvert(F, ma, ka, Af, ka, A, lda);
-        freduce(G, ma, ka, Af, ka);
-        fconvert(F, kb, nb, Bf, nb, B, ldb);
-        freduce(G, kb, nb, Bf, nb);
-
-        if (!F.isZero(beta)){
-            fconvert(F, m, n, Cf, n, C, ldc);
-            freduce (G, m, n, Cf, n);
-        }
-        MMHelper<NewField, MMHelperAlgo::Winograd> HG(G,H.recLevel, ParSeqHelper::Sequential());
-        fgemm (G, ta, tb, m, n, k, alphaf, Af, ldaf, Bf, ldbf, betaf, Cf, ldcf, HG);
+        // C is computed by tiles of about ts x ts: each tile is widened, accumulated with the products
+        // of the matching slices of op(A) and op(B) of depth about ts, widened one at a time, then
+        // narrowed back into C. No operand is ever widened in full: ts is chosen so that the three
+        // widened blocks fit in __FFLASFFPACK_CONVERT_PANEL_BYTES, except when the product is large
+        // enough for Winograd, where ts is raised to its threshold so that the products of tiles keep
+        // their first recursive level. The tiles are between ts and 2ts wide.
+        size_t ts = std::max (size_t(1), size_t (std::sqrt (double(__FFLASFFPACK_CONVERT_PANEL_BYTES) / (3.*sizeof(FloatElement)))));
+        const size_t th = WinogradThreshold (G);
+        if (std::min (std::min (m, n), k) >= th) ts = std::max (ts, th);
+        const size_t nmb = std::max (size_t(1), m/ts);
+        const size_t nnb = std::max (size_t(1), n/ts);
+        const size_t nkb = std::max (size_t(1), k/ts);
+        const size_t mb = (m+nmb-1)/nmb;
+        const size_t nb = (n+nnb-1)/nnb;
+        const size_t kb = (k+nkb-1)/nkb;
+        const size_t ldaf = (ta == FflasTrans) ? mb : kb;
+        const size_t ldbf = (tb == FflasTrans) ? kb : nb;
+        const size_t ldcf = nb;
+        FloatElement* Af = FFLAS::fflas_new(G, mb, kb);
+        FloatElement* Bf = FFLAS::fflas_new(G, kb, nb);
+        FloatElement* Cf = FFLAS::fflas_new(G, mb, nb);
 
-        finit (F, m, n, Cf, n, C, ldc);
+        MMHelper<NewField, MMHelperAlgo::Winograd> HG(G,H.recLevel, ParSeqHelper::Sequential());
+        for (size_t i = 0; i < m; i += mb){
+            const size_t mi = std::min (mb, m-i);
+            for (size_t j = 0; j < n; j += nb){
+                const size_t nj = std::min (nb, n-j);
+                typename Field::Element_ptr Cij = C+i*ldc+j;
+                if (!F.isZero(beta)){
+                    fconvert(F, mi, nj, Cf, ldcf, Cij, ldc);
+                    freduce (G, mi, nj, Cf, ldcf);
+                }
+                for (size_t l = 0; l < k; l += kb){
+                    const size_t kl = std::min (kb, k-l);
+                    if (ta == FflasTrans){
+                        fconvert(F, kl, mi, Af, ldaf, A+l*lda+i, lda);
+                        freduce(G, kl, mi, Af, ldaf);
+                    } else {
+                        fconvert(F, mi, kl, Af, ldaf, A+i*lda+l, lda);
+                        freduce(G, mi, kl, Af, ldaf);
+                    }
+                    if (tb == FflasTrans){
+                        fconvert(F, nj, kl, Bf, ldbf, B+j*ldb+l, ldb);
+                        freduce(G, nj, kl, Bf, ldbf);
+                    } else {
+                        fconvert(F, kl, nj, Bf, ldbf, B+l*ldb+j, ldb);
+                        freduce(G, kl, nj, Bf, ldbf);
+                    }
+                    fgemm (G, ta, tb, mi, nj, kl, alphaf, Af, ldaf, Bf, ldbf, l ? G.one : betaf, Cf, ldcf, HG);
+                }
+                finit (F, mi, nj, Cf, ldcf, Cij, ldc);
+            }
+        }
 
         fflas_delete (Af);
         fflas_delete (Bf);
@@ -251,6 +288,8 @@ namespace FFLAS {
            typename Field::Element_ptr C, const size_t ldc,
            MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::ConvertTo<ElementCategories::MachineFloatTag>, ParSeqHelper::Sequential> & H)
     {
+        if (!F.isZero (alpha) && Protected::useGF2 (F, std::min (std::min (m,n),k), __FFLASFFPACK_GF2_FGEMM_THRESHOLD))
+            return Protected::fgemm_gf2 (F, ta, tb, m, n, k, A, lda, B, ldb, beta, C, ldc);
         if (!std::is_same<Field,Givaro::Modular<float> >::value){
             if (F.cardinality() == 2)
                 return Protected::fgemm_convert<Givaro::Modular<float>,Field>(F,ta,tb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,H);
@@ -339,6 +378,8 @@ namespace FFLAS {
             fscalin(F, m, n, beta, C, ldc);
             return C;
         }
+        FFLASFFPACK_INSTRUMENT(fgemm, 2.*double(m)*double(n)*double(k),
+                               sizeof(typename Field::Element)*(double(m)*double(k)+double(k)*double(n)+2.*double(m)*double(n)));
         Checker_fgemm<Field> checker(F,m,n,k,beta,C,ldc);
         fgemm(F,ta,tb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,FFLAS::ParSeqHelper::Sequential());
         checker.check(ta,tb,alpha,A,lda,B,ldb,C);
@@ -404,6 +445,8 @@ namespace FFLAS {
         // detect fger
         if (k==1 and ...) {}
 #endif
+        if (!F.isZero (alpha) && Protected::useGF2 (F, std::min (std::min (m,n),k), __FFLASFFPACK_GF2_FGEMM_THRESHOLD))
+            return Protected::fgemm_gf2 (F, ta, tb, m, n, k, A, lda, B, ldb, beta, C, ldc);
         if (!std::is_same<Field,Givaro::Modular<float> >::value){
             if (F.cardinality() == 2)
                 return Protected::fgemm_convert<Givaro::Modular<float>,Field>(F,ta,tb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,H);
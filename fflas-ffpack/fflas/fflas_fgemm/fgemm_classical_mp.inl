@@ -425,7 +425,131 @@ namespace FFLAS {
         return C;
     }
 
+    /* Pipelined multimodular product over Z.
+     * op(B) is converted once to the whole RNS basis. C is then computed by row blocks, streamed
+     * through a three stage software pipeline: at step t, the conversion to RNS of the rows of op(A)
+     * of block t, the per prime products of block t-1 and the reconstruction of block t-2, written
+     * directly into C, run as concurrent tasks. Apart from the residues of op(B), only the residues
+     * of two row blocks of op(A) and of C are live at once: no integer accumulator is needed.
+     * Must be called within a PAR_BLOCK, as the other parallel fgemm.
+     */
+    template<class Param>
+    inline Givaro::Integer*
+    fgemm (const Givaro::ZRing<Givaro::Integer>& F,
+           const FFLAS_TRANSPOSE ta,
+           const FFLAS_TRANSPOSE tb,
+           const size_t m, const size_t n,const size_t k,
+           const Givaro::Integer alpha,
+           const Givaro::Integer* A, const size_t lda,
+           const Givaro::Integer* B, const size_t ldb,
+           Givaro::Integer beta,
+           Givaro::Integer* C, const size_t ldc,
+           MMHelper<Givaro::ZRing<Givaro::Integer>, MMHelperAlgo::Classic, ModeCategories::ConvertTo<ElementCategories::RNSElementTag>, ParSeqHelper::Parallel<CuttingStrategy::RNSPipeline,Param> >  & H)
+    {
+        if (!m || !n) return C;
+        if (alpha == 0 || k == 0){
+            fscalin(F,m,n,beta,C,ldc);
+            return C;
+        }
+
+        // compute bit size of feasible prime for FFLAS
+        size_t _k=k,lk=0;
+        while ( _k ) {_k>>=1; ++lk;}
+        size_t prime_bitsize= (53-lk)>>1;
 
+        // compute bound on the output
+        if (H.normA==0)
+            H.normA = InfNorm ((ta==FflasNoTrans)?m:k,(ta==FflasNoTrans)?k:m,A,lda);
+        size_t logA = H.normA.bitsize();
+        if (H.normB==0)
+            H.normB = InfNorm ((tb==FflasNoTrans)?k:n,(tb==FflasNoTrans)?n:k,B,ldb);
+        size_t logB = H.normB.bitsize();
+
+        Givaro::Integer mC = 2*uint64_t(k)*H.normA*H.normB*abs(alpha);
+        if (mC == 0){
+            fscalin(F,m,n,beta,C,ldc);
+            return C;
+        }
+
+        FFPACK::rns_double RNS(mC, prime_bitsize);
+        const size_t rns_size = RNS._size;
+        const size_t nt = std::max(H.parseq.numthreads(),(size_t)1);
+        const size_t kA = (logA/16)+((logA%16)?1:0);
+        const size_t kB = (logB/16)+((logB%16)?1:0);
+
+        // row blocks of C: at least 8, so that the three stages overlap
+        const size_t nblocks = std::min(m, std::max(nt,(size_t)8));
+        const size_t mb = (m+nblocks-1)/nblocks;
+        const size_t nsteps = (m+mb-1)/mb;
+
+        size_t Bcold,Browd;
+        if (tb == FFLAS::FflasNoTrans){Browd=k; Bcold = n; }
+        else { Browd=n; Bcold = k;}
+        const size_t sA = mb*k;
+        const size_t sB = Browd*Bcold;
+        const size_t sC = mb*n;
+
+        double* Bres = FFLAS::fflas_new<double>(rns_size*sB);
+        RNS.init(Browd,Bcold,Bres,sB,B,ldb,kB);
+        std::vector<double> alphap(rns_size);
+        for (size_t l=0; l<rns_size; ++l)
+            RNS._field_rns[l].init(alphap[l], alpha);
+
+        // residues of the row blocks in flight, in rings of two slots
+        double* Ares[2]; double* Cres[2];
+        for (size_t i=0; i<2; ++i){
+            Ares[i] = FFLAS::fflas_new<double>(rns_size*sA);
+            Cres[i] = FFLAS::fflas_new<double>(rns_size*sC);
+        }
+        const FFPACK::rns_double* R = &RNS;
+        const double* alphad = alphap.data();
+        const double* Bp = Bres;
+
+        for (size_t t=0; t<nsteps+2; ++t){
+            SYNCH_GROUP(
+                // stage 1: conversion of the rows of op(A) of block t
+                if (t < nsteps){
+                    const size_t i = t*mb;
+                    const size_t rows = std::min(mb, m-i);
+                    double* Ap = Ares[t%2];
+                    if (ta == FFLAS::FflasNoTrans){
+                        TASK(MODE(READ(A[i*lda]) WRITE(Ap[0])),
+                             R->init(rows,k,Ap,sA,A+i*lda,lda,kA););
+                    } else {
+                        TASK(MODE(READ(A[i]) WRITE(Ap[0])),
+                             R->init(k,rows,Ap,sA,A+i,lda,kA););
+                    }
+                }
+                // stage 2: one product per modulus for block t-1
+                if (t >= 1 && t-1 < nsteps){
+                    const size_t rows = std::min(mb, m-(t-1)*mb);
+                    const size_t ldap = (ta == FFLAS::FflasNoTrans) ? k : rows;
+                    const double* Ap = Ares[(t-1)%2];
+                    double* Cp = Cres[(t-1)%2];
+                    for (size_t l=0; l<rns_size; ++l){
+                        TASK(MODE(READ(Ap[l*sA], Bp[l*sB]) WRITE(Cp[l*sC])),
+                             fgemm(R->_field_rns[l], ta, tb, rows, n, k, alphad[l], Ap+l*sA, ldap, Bp+l*sB, Bcold,
+                                   R->_field_rns[l].zero, Cp+l*sC, n, ParSeqHelper::Sequential()););
+                    }
+                }
+                // stage 3: reconstruction of block t-2 into C, by sub-blocks of rows
+                if (t >= 2){
+                    const size_t i = (t-2)*mb;
+                    const size_t rows = std::min(mb, m-i);
+                    const size_t rsub = std::max(rows/nt,(size_t)1);
+                    const double* Cp = Cres[(t-2)%2];
+                    for (size_t ii=0; ii<rows; ii+=rsub){
+                        const size_t r = std::min(rsub, rows-ii);
+                        TASK(MODE(READ(Cp[ii*n]) READWRITE(C[(i+ii)*ldc]) CONSTREFERENCE(beta)),
+                             R->convert(r, n, beta, C+(i+ii)*ldc, ldc, Cp+ii*n, sC););
+                    }
+                }
+            );
+        }
+
+        FFLAS::fflas_delete(Bres,Ares[0],Ares[1],Cres[0],Cres[1]);
+        return C;
+    }
 
     // Simple switch Winograd -> Classic (waiting for Winograd's algorithm to be generic wrt ModeTrait)
     template<typename RNS, class ModeT>
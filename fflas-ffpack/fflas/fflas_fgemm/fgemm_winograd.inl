@@ -391,6 +391,9 @@ namespace FFLAS{
             fscalin(F,m,n,beta,C,ldc);
             return C;
         }
+        // each recursive call is recorded at its level
+        FFLASFFPACK_INSTRUMENT(fgemm, 2.*double(m)*double(n)*double(k),
+                               sizeof(typename Field::Element)*(double(m)*double(k)+double(k)*double(n)+2.*double(m)*double(n)));
         if (H.recLevel < 0) {
             H.recLevel = Protected::WinogradSteps (F, min3(m,k,n));
         }
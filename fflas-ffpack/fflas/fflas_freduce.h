@@ -30,6 +30,7 @@
 #include "fflas-ffpack/fflas/fflas_simd.h"
 #include "fflas-ffpack/field/field-traits.h"
 #include "fflas-ffpack/utils/cast.h"
+#include "fflas-ffpack/utils/instrumentation.h"
 
 namespace FFLAS {
 
@@ -74,6 +75,7 @@ namespace FFLAS {
              typename Field::ConstElement_ptr  B, const size_t incY,
              typename Field::Element_ptr A, const size_t incX)
     {
+        FFLASFFPACK_INSTRUMENT(freduce, m, 2.*sizeof(typename Field::Element)*double(m));
         return details::freduce (F,m,B,incY,A,incX,typename FieldTraits<Field>::category());
     }
 
@@ -82,6 +84,7 @@ namespace FFLAS {
     freduce (const Field & F, const size_t m,
              typename Field::Element_ptr A, const size_t incX)
     {
+        FFLASFFPACK_INSTRUMENT(freduce, m, 2.*sizeof(typename Field::Element)*double(m));
         return details::freduce (F,m,A,incX,typename FieldTraits<Field>::category());
     }
 
@@ -101,6 +104,7 @@ namespace FFLAS {
            ConstOtherElement_ptr Y, const size_t incY,
            typename Field::Element_ptr X, const size_t incX)
     {
+        FFLASFFPACK_INSTRUMENT(finit, n, (sizeof(*Y)+sizeof(typename Field::Element))*double(n));
         typename Field::Element_ptr Xi = X ;
         ConstOtherElement_ptr Yi = Y ;
 
@@ -120,6 +124,7 @@ namespace FFLAS {
     finit (const Field& F, const size_t n,
            typename Field::Element_ptr X, const size_t incX)
     {
+        FFLASFFPACK_INSTRUMENT(finit, n, 2.*sizeof(typename Field::Element)*double(n));
         typename Field::Element_ptr Xi = X ;
 
         if (incX == 1)
@@ -142,6 +147,7 @@ namespace FFLAS {
     freduce (const Field& F, const size_t m , const size_t n,
              typename Field::Element_ptr A, const size_t lda)
     {
+        FFLASFFPACK_INSTRUMENT(freduce, double(m)*double(n), 2.*sizeof(typename Field::Element)*double(m)*double(n));
         if (n == lda)
             freduce (F, n*m, A, 1);
         else
@@ -186,6 +192,7 @@ namespace FFLAS {
              typename Field::ConstElement_ptr B, const size_t ldb,
              typename Field::Element_ptr A, const size_t lda)
     {
+        FFLASFFPACK_INSTRUMENT(freduce, double(m)*double(n), 2.*sizeof(typename Field::Element)*double(m)*double(n));
         for (size_t i = 0 ; i < m ; ++i) {
             freduce(F,n,B+i*ldb,1,A+i*lda,1);
         }
@@ -208,6 +215,7 @@ namespace FFLAS {
            const OtherElement_ptr B, const size_t ldb,
            typename Field::Element_ptr A, const size_t lda)
     {
+        FFLASFFPACK_INSTRUMENT(finit, double(m)*double(n), (sizeof(*B)+sizeof(typename Field::Element))*double(m)*double(n));
         if (n == lda && n == ldb)
             finit (F, n*m, B, 1, A, 1);
         else
@@ -221,6 +229,7 @@ namespace FFLAS {
     finit (const Field& F, const size_t m , const size_t n,
            typename Field::Element_ptr A, const size_t lda)
     {
+        FFLASFFPACK_INSTRUMENT(finit, double(m)*double(n), 2.*sizeof(typename Field::Element)*double(m)*double(n));
         if (n == lda)
             finit (F, n*m, A, 1);
         else
@@ -110,6 +110,85 @@ namespace FFLAS{
         return pass;
     }
 
+    /** @brief Number of random projections needed by the block Freivalds check.
+     *
+     * A random vector over a field of cardinality \f$c\f$ misses a wrong product
+     * with probability at most \f$1/c\f$: \f$s\f$ independent vectors reach
+     * \f$c^{-s} \leq \f$ \p errorBound.
+     */
+    template<class Field> inline size_t
+    freivaldsProjections (const Field& F, const double errorBound) {
+        Givaro::Integer card;
+        F.cardinality (card);
+        if (card <= 1 || errorBound <= 0. || errorBound >= 1.) return 1;
+        const double c = double(card);
+        return std::max (size_t(1), size_t (std::ceil (-std::log (errorBound) / std::log (c))));
+    }
+
+    /** @brief  freivalds: block variant with a target error bound.
+     *
+     * Randomly Checks \f$C = \alpha \mathrm{op}(A) \times \mathrm{op}(B)\f$ with a block
+     * \f$V\f$ of \f$s\f$ random vectors, \f$s\f$ given by freivaldsProjections, in one pass:
+     * the projections \f$\mathrm{op}(B).V\f$, \f$\alpha \mathrm{op}(A).(\mathrm{op}(B).V)\f$ and \f$C.V\f$
+     * are matrix products, run through fgemm with the helper \p psH (pfgemm for a parallel helper).
+     * This makes the check over tiny fields (GF(2), GF(3)) as cheap as a few matrix-vector products
+     * per bit of certainty, instead of as many sequential calls to freivalds.
+     * \param errorBound the probability of accepting a wrong product is at most \p errorBound
+     * \param psH a ParSeqHelper::Sequential or ParSeqHelper::Parallel helper
+     * The other parameters are as in freivalds.
+     * \warning a parallel helper must be used within a PAR_BLOCK.
+     */
+    template<class Field, class ParSeqTrait> inline bool
+    freivalds (const Field& F,
+               const FFLAS_TRANSPOSE ta,
+               const FFLAS_TRANSPOSE tb,
+               const size_t m, const size_t n, const size_t k,
+               const typename Field::Element alpha,
+               typename Field::ConstElement_ptr A, const size_t lda,
+               typename Field::ConstElement_ptr B, const size_t ldb,
+               typename Field::ConstElement_ptr C, const size_t ldc,
+               const double errorBound, const ParSeqTrait& psH) {
+
+        if (!m || !n) return true;
+        const size_t s = freivaldsProjections (F, errorBound);
+
+        typename Field::Element_ptr V, Y, X;
+        V = FFLAS::fflas_new(F,n,s);
+        Y = FFLAS::fflas_new(F,k,s);
+        X = FFLAS::fflas_new(F,m,s);
+
+        typename Field::RandIter G(F);
+        FFLAS::frand (F, G, n, s, V, s);
+
+        // Y <-- \mathrm{op}(B).V
+        FFLAS::fgemm (F, tb, FflasNoTrans, k, s, n, F.one, B, ldb, V, s, F.zero, Y, s, psH);
+        // X <-- alpha.\mathrm{op}(A).Y
+        FFLAS::fgemm (F, ta, FflasNoTrans, m, s, k, alpha, A, lda, Y, s, F.zero, X, s, psH);
+        // X <-- -C.V+X =?= 0
+        FFLAS::fgemm (F, FflasNoTrans, FflasNoTrans, m, s, n, F.mOne, C, ldc, V, s, F.one, X, s, psH);
+
+        bool pass = FFLAS::fiszero (F, m, s, X, s);
+
+        FFLAS::fflas_delete(V,Y,X);
+        return pass;
+    }
+
+    /** @brief  freivalds: sequential block variant with a target error bound.
+     * \see freivalds with a ParSeqHelper
+     */
+    template<class Field> inline bool
+    freivalds (const Field& F,
+               const FFLAS_TRANSPOSE ta,
+               const FFLAS_TRANSPOSE tb,
+               const size_t m, const size_t n, const size_t k,
+               const typename Field::Element alpha,
+               typename Field::ConstElement_ptr A, const size_t lda,
+               typename Field::ConstElement_ptr B, const size_t ldb,
+               typename Field::ConstElement_ptr C, const size_t ldc,
+               const double errorBound) {
+        return freivalds (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, C, ldc, errorBound, ParSeqHelper::Sequential());
+    }
+
 }
 
 
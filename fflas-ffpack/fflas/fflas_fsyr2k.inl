@@ -77,14 +77,72 @@ namespace FFLAS {
                 // C12 <- alpha B1 * A2^T + C12
                 fgemm (F, trans, oppTrans, N1, N2, K, alpha, B, ldb, A2, lda, F.one, C12, ldc);
             } else {
-                // C21 <- alpha A2 * B1^T + beta C12
+                // C21 <- alpha A2 * B1^T + beta C21
                 fgemm (F, trans, oppTrans, N2, N1, K, alpha, A2, lda, B, ldb, beta, C21, ldc);
-                // C21 <- alpha B2 * A1^T + C12
+                // C21 <- alpha B2 * A1^T + C21
                 fgemm (F, trans, oppTrans, N2, N1, K, alpha, B2, ldb, A, lda, F.one, C21, ldc);
             }
             return C;
         }
     }
+
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fsyr2k (const Field& F,
+            const FFLAS_UPLO UpLo,
+            const FFLAS_TRANSPOSE trans,
+            const size_t N,
+            const size_t K,
+            const typename Field::Element alpha,
+            typename Field::ConstElement_ptr A, const size_t lda,
+            typename Field::ConstElement_ptr B, const size_t ldb,
+            const typename Field::Element beta,
+            typename Field::Element_ptr C, const size_t ldc,
+            const ParSeqHelper::Parallel<Cut,Param> par){
+
+        size_t nt = par.numthreads();
+        if (N <= 1 || !K || nt == 1)
+            return fsyr2k (F, UpLo, trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+
+        size_t N1 = N>>1;
+        size_t N2 = N - N1;
+        // Comments written for the case UpLo==FflasUpper, trans==FflasNoTrans
+        FFLAS_TRANSPOSE oppTrans;
+        if (trans==FflasNoTrans) {oppTrans=FflasTrans;}
+        else {oppTrans=FflasNoTrans;}
+
+        typename Field::ConstElement_ptr A2 = A + N1*(trans==FflasNoTrans?lda:1);
+        typename Field::ConstElement_ptr B2 = B + N1*(trans==FflasNoTrans?ldb:1);
+        typename Field::Element_ptr C12 = C + N1;
+        typename Field::Element_ptr C21 = C + N1*ldc;
+        typename Field::Element_ptr C22 = C12 + N1*ldc;
+
+        size_t nt2 = nt >> 1;
+        ParSeqHelper::Parallel<Cut, Param> ps_rec1(nt2);
+        ParSeqHelper::Parallel<Cut, Param> ps_rec2(nt - nt2);
+        ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> ps_fgemm (nt);
+
+        if (UpLo == FflasUpper) {
+            // C12 <- alpha A1 * B2^T + beta C12
+            fgemm (F, trans, oppTrans, N1, N2, K, alpha, A, lda, B2, ldb, beta, C12, ldc, ps_fgemm);
+            // C12 <- alpha B1 * A2^T + C12
+            fgemm (F, trans, oppTrans, N1, N2, K, alpha, B, ldb, A2, lda, F.one, C12, ldc, ps_fgemm);
+        } else {
+            // C21 <- alpha A2 * B1^T + beta C21
+            fgemm (F, trans, oppTrans, N2, N1, K, alpha, A2, lda, B, ldb, beta, C21, ldc, ps_fgemm);
+            // C21 <- alpha B2 * A1^T + C21
+            fgemm (F, trans, oppTrans, N2, N1, K, alpha, B2, ldb, A, lda, F.one, C21, ldc, ps_fgemm);
+        }
+        SYNCH_GROUP(
+                    // C11 <- alpha (A1 x B1^T + B1 x A1^T) + beta C11
+                    TASK(MODE(READ(A[0], B[0]) READWRITE(C[0]) CONSTREFERENCE(A, B, C, F, ps_rec1)),
+                         fsyr2k (F, UpLo, trans, N1, K, alpha, A, lda, B, ldb, beta, C, ldc, ps_rec1));
+                    // C22 <- alpha (A2 x B2^T +B2 x A2^T) + beta C22
+                    TASK(MODE(READ(A2[0], B2[0]) READWRITE(C22[0]) CONSTREFERENCE(A2, B2, C22, F, ps_rec2)),
+                         fsyr2k (F, UpLo, trans, N2, K, alpha, A2, lda, B2, ldb, beta, C22, ldc, ps_rec2));
+                   );
+        return C;
+    }
 } // namespace FFLAS
 #endif //__FFLASFFPACK_fflas_fsyr2k_INL
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
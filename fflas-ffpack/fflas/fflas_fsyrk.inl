@@ -767,6 +767,84 @@ namespace FFLAS {
             return C;
         }
     }
+
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fsyrk (const Field& F,
+           const FFLAS_UPLO UpLo,
+           const FFLAS_TRANSPOSE trans,
+           const size_t N,
+           const size_t K,
+           const typename Field::Element alpha,
+           typename Field::Element_ptr A, const size_t lda,
+           typename Field::ConstElement_ptr D, const size_t incD,
+           const std::vector<bool>& twoBlocks,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           const ParSeqHelper::Parallel<Cut,Param> par,
+           const size_t threshold){
+
+        size_t nt = par.numthreads();
+        if (N <= threshold || nt == 1)
+            return fsyrk (F, UpLo, trans, N, K, alpha, A, lda, D, incD, twoBlocks, beta, C, ldc, threshold);
+
+        size_t incRow,incCol;
+        FFLAS_TRANSPOSE oppTrans;
+        if (trans==FflasNoTrans) {incRow=lda;incCol=1;oppTrans=FflasTrans;}
+        else {incRow = 1; incCol = lda;oppTrans=FflasNoTrans;}
+
+        size_t N1 = N>>1;
+        if (twoBlocks[N1-1]) N1++; // don't split a 2x2 block
+        size_t N2 = N - N1;
+        // Comments written for the case UpLo==FflasUpper, trans==FflasNoTrans
+
+        typename Field::Element_ptr A2 = A + N1*incRow;
+        typename Field::Element_ptr C12 = C + N1;
+        typename Field::Element_ptr C21 = C + N1*ldc;
+        typename Field::Element_ptr C22 = C12 + N1*ldc;
+
+        size_t nt2 = nt >> 1;
+        size_t ntr = nt - nt2;
+        ParSeqHelper::Parallel<Cut, Param> ps_rec1(nt2);
+        ParSeqHelper::Parallel<Cut, Param> ps_rec2(ntr);
+        ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> ps_fgemm (nt);
+
+        typename Field::Element_ptr temp = fflas_new (F, std::max(N2,N1),K);
+        size_t ldt, incRowT,incColT;
+        if (trans==FflasNoTrans) {ldt=K; incRowT=ldt; incColT=1;}
+        else {ldt = N2; incRowT=1; incColT=ldt;}
+
+        // temp <- A2 x D1
+        typename Field::Element_ptr Ai = A2, Ti = temp;
+        typename Field::ConstElement_ptr Di = D;
+        for (size_t i=0; i<K; Ai += incCol, Ti += incColT, Di+=incD,i++){
+            if (!twoBlocks[i])
+                fscal (F, N2, *Di, Ai, incRow, Ti, incRowT);
+            else {
+                fscal (F, N2, *Di, Ai, incRow, Ti+incColT, incRowT);
+                fscal (F, N2, *Di, Ai+incCol, incRow, Ti, incRowT);
+                Ti+=incColT; Ai+=incCol; Di+=incD; i++;
+            }
+        }
+        if (UpLo == FflasUpper) {
+            // C12 <- alpha A1 x temp^T + beta C12
+            fgemm (F, trans, oppTrans, N1, N2, K, alpha, A, lda, temp, ldt, beta, C12, ldc, ps_fgemm);
+        } else {
+            // C21 <- alpha temp x A11^T + beta C21
+            fgemm (F, trans, oppTrans, N2, N1, K, alpha, temp, ldt, A, lda, beta, C21, ldc, ps_fgemm);
+        }
+        fflas_delete (temp);
+
+        SYNCH_GROUP(
+                    // C11 <- alpha A1 x D1 x A1^T + beta C11 and A1 <- A1 x D1
+                    TASK(MODE(READ(D[0]) READWRITE(A[0]) WRITE(C[0]) CONSTREFERENCE(A, D, C, F, twoBlocks, ps_rec1)),
+                         fsyrk (F, UpLo, trans, N1, K, alpha, A, lda, D, incD, twoBlocks, beta, C, ldc, ps_rec1, threshold));
+                    // C22 <- alpha A2 x D1 x A2^T + beta C22 and A2 <- A2 x D1
+                    TASK(MODE(READ(D[0]) READWRITE(A2[0]) WRITE(C22[0]) CONSTREFERENCE(A2, D, C22, F, twoBlocks, ps_rec2)),
+                         fsyrk (F, UpLo, trans, N2, K, alpha, A2, lda, D, incD, twoBlocks, beta, C22, ldc, ps_rec2, threshold));
+                   );
+        return C;
+    }
 }
 
 #endif //__FFLASFFPACK_fflas_fsyrk_INL
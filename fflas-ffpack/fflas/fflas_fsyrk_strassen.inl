@@ -755,6 +755,362 @@ namespace FFLAS {
         WH.checkOut(F, uplo, N, N, C, ldc);
         return C;
     }
+
+    namespace Protected {
+        // R <- M x Y if trans==FflasNoTrans, R <- Y x M otherwise, where Y = [ x.I  y.I ]
+        //                                                                     [ -y.I x.I ]
+        // and M is N2 x K2 (resp. K2 x N2)
+        template<class Field>
+        inline void
+        mulY (const Field& F, const FFLAS_TRANSPOSE trans, const size_t N2, const size_t K2,
+              const typename Field::Element x, const typename Field::Element y,
+              typename Field::ConstElement_ptr M, const size_t ldm,
+              typename Field::Element_ptr R, const size_t ldr)
+        {
+            size_t K4 = K2>>1;
+            size_t rows, cols;
+            typename Field::ConstElement_ptr Mr;
+            typename Field::Element_ptr Rr;
+            if (trans == FflasNoTrans){
+                rows = N2; cols = K4; Mr = M + K4; Rr = R + K4;
+            } else {
+                rows = K4; cols = N2; Mr = M + K4*ldm; Rr = R + K4*ldr;
+            }
+            typename Field::Element negy;
+            F.init (negy);
+            F.neg (negy, y);
+                // R <- x M - y Mr
+            fscal (F, rows, cols, x, M, ldm, R, ldr);
+            faxpy (F, rows, cols, negy, Mr, ldm, R, ldr);
+                // Rr <- y M + x Mr
+            fscal (F, rows, cols, x, Mr, ldm, Rr, ldr);
+            faxpy (F, rows, cols, y, M, ldm, Rr, ldr);
+        }
+    }
+
+        // Parallel version: the five products P1,...,P5 are independent tasks, at the expense
+        // of four temporaries for S1,...,S4 and three for P1, P4 and P5.
+        // Operands and results are kept reduced, leaving the bound tracking to the sequential leaves.
+        // Assumes that 2^(reclevel+1) divides N and K
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fsyrk_strassen (const Field& F,
+                    const FFLAS_UPLO uplo,
+                    const FFLAS_TRANSPOSE trans,
+                    const size_t N,
+                    const size_t K,
+                    const typename Field::Element y1,
+                    const typename Field::Element y2,
+                    const typename Field::Element alpha,
+                    typename Field::ConstElement_ptr A, const size_t lda,
+                    const typename Field::Element beta,
+                    typename Field::Element_ptr C, const size_t ldc,
+                    MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, ParSeqHelper::Parallel<Cut,Param> > & WH
+                    ) {
+        const size_t nt = WH.parseq.numthreads();
+        if (!WH.recLevel || nt <= 1){
+            MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag> SH (F, WH.recLevel);
+            return fsyrk (F, uplo, trans, N, K, alpha, A, lda, beta, C, ldc, SH);
+        }
+        typedef MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, ParSeqHelper::Parallel<Cut,Param> > MMH_t;
+
+            // Comments are written for the NoTrans, Lower version
+        size_t N2 = N>>1;
+        size_t K2 = K>>1;
+        size_t Arows, Acols;
+        typename Field::ConstElement_ptr A11 = A, A12, A21, A22;
+        if (trans == FflasNoTrans){
+            A12 = A + K2; A21 = A + N2*lda; A22 = A21 + K2; Arows = N2; Acols = K2;
+        } else {
+            A12 = A + K2*lda; A21 = A + N2; A22 = A12 + N2; Arows = K2; Acols = N2;
+        }
+            // For the Upper version, C21 and the temporaries store the transposed blocks
+        typename Field::Element_ptr C11 = C, C21, C22 = C + N2*(ldc+1);
+        C21 = (uplo == FflasLower) ? C + N2*ldc : C + N2;
+        FFLAS_TRANSPOSE OppTrans = (trans == FflasNoTrans)? FflasTrans : FflasNoTrans;
+
+        size_t lds = Acols;
+        typename Field::Element_ptr S1 = fflas_new (F, Arows, Acols);
+        typename Field::Element_ptr S2 = fflas_new (F, Arows, Acols);
+        typename Field::Element_ptr S3 = fflas_new (F, Arows, Acols);
+        typename Field::Element_ptr S4 = fflas_new (F, Arows, Acols);
+        typename Field::Element_ptr T1 = fflas_new (F, N2, N2);
+        typename Field::Element_ptr T4 = fflas_new (F, N2, N2);
+        typename Field::Element_ptr T5 = fflas_new (F, N2, N2);
+
+            // P3 and P4 are twice as expensive as the symmetric products P1, P2 and P5
+        ParSeqHelper::Parallel<Cut,Param> psS (std::max (nt/7, size_t(1)));
+        ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> psG (std::max (2*nt/7, size_t(1)));
+        MMH_t H1 (F, WH.recLevel-1, psS);
+        MMH_t H2 (F, WH.recLevel-1, psS);
+        MMH_t H5 (F, WH.recLevel-1, psS);
+
+        SYNCH_GROUP(
+                        // P1 = A11 x A11^T in T1
+                    TASK(MODE(READ(A11[0]) WRITE(T1[0]) CONSTREFERENCE(F, H1)),
+                         fsyrk_strassen (F, uplo, trans, N2, K2, y1, y2, alpha, A11, lda, F.zero, T1, N2, H1));
+                        // P2 = A12 x A12^T + beta C11 in C11
+                    TASK(MODE(READ(A12[0]) READWRITE(C11[0]) CONSTREFERENCE(F, H2)),
+                         fsyrk_strassen (F, uplo, trans, N2, K2, y1, y2, alpha, A12, lda, beta, C11, ldc, H2));
+
+                        // S2 = A22 - A21 x Y
+                    Protected::mulY (F, trans, N2, K2, y1, y2, A21, lda, S2, lds);
+                    fnegin (F, Arows, Acols, S2, lds);
+                    faddin (F, Arows, Acols, A22, lda, S2, lds);
+                        // S1 = (A21 - A11) x Y
+                    fsub (F, Arows, Acols, A21, lda, A11, lda, S3, lds);
+                    Protected::mulY (F, trans, N2, K2, y1, y2, S3, lds, S1, lds);
+                        // S3 = S1 - A22
+                    fsub (F, Arows, Acols, S1, lds, A22, lda, S3, lds);
+                        // S4 = S3 + A12
+                    fadd (F, Arows, Acols, S3, lds, A12, lda, S4, lds);
+
+                        // P4^T = S2 x S1^T in T4
+                    TASK(MODE(READ(S1[0], S2[0]) WRITE(T4[0]) CONSTREFERENCE(F, psG)),
+                         if (uplo == FflasLower)
+                             fgemm (F, trans, OppTrans, N2, N2, K2, alpha, S2, lds, S1, lds, F.zero, T4, N2, psG);
+                         else
+                             fgemm (F, trans, OppTrans, N2, N2, K2, alpha, S1, lds, S2, lds, F.zero, T4, N2, psG););
+                        // P5 = S3 x S3^T in T5
+                    TASK(MODE(READ(S3[0]) WRITE(T5[0]) CONSTREFERENCE(F, H5)),
+                         fsyrk_strassen (F, uplo, trans, N2, K2, y1, y2, alpha, S3, lds, F.zero, T5, N2, H5));
+                        // P3 = A22 x S4^T + beta C21 in C21
+                    TASK(MODE(READ(A22[0], S4[0]) READWRITE(C21[0]) CONSTREFERENCE(F, psG)),
+                         if (uplo == FflasLower)
+                             fgemm (F, trans, OppTrans, N2, N2, K2, alpha, A22, lda, S4, lds, beta, C21, ldc, psG);
+                         else
+                             fgemm (F, trans, OppTrans, N2, N2, K2, alpha, S4, lds, A22, lda, beta, C21, ldc, psG););
+                   );
+        fflas_delete (S1, S2, S3, S4);
+
+            // U3 = P1 + P2 in C11
+        faddin (F, uplo, N2, T1, N2, C11, ldc);
+
+            // U1 = P1 + P5 in T1, made explicit
+        faddin (F, uplo, N2, T5, N2, T1, N2);
+        if (uplo == FflasLower)
+            for (size_t i=0; i<N2; ++i)
+                fassign (F, i, T1 + i*N2, 1, T1 + i, N2);
+        else
+            for (size_t i=0; i<N2; ++i)
+                fassign (F, i, T1 + i, N2, T1 + i*N2, 1);
+
+            // U2 = U1 + P4 in T1
+        for (size_t i=0; i<N2; ++i)
+            faddin (F, N2, T4 + i*N2, 1, T1 + i, N2);
+
+            // U4 = U2 + P3 in C21
+        faddin (F, N2, N2, T1, N2, C21, ldc);
+
+            // U5 = U2 + P4^T + beta C22 in C22
+        faddin (F, uplo, N2, T4, N2, T1, N2);
+        for (size_t i=0; i<N2; ++i){
+            size_t j = (uplo == FflasLower) ? 0 : i;
+            size_t len = (uplo == FflasLower) ? i+1 : N2-i;
+            if (F.isZero (beta))
+                fassign (F, len, T1 + i*N2 + j, 1, C22 + i*ldc + j, 1);
+            else {
+                fscalin (F, len, beta, C22 + i*ldc + j, 1);
+                faddin (F, len, T1 + i*N2 + j, 1, C22 + i*ldc + j, 1);
+            }
+        }
+        fflas_delete (T1, T4, T5);
+        return C;
+    }
+
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fsyrk (const Field& F,
+           const FFLAS_UPLO UpLo,
+           const FFLAS_TRANSPOSE trans,
+           const size_t N,
+           const size_t K,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, ParSeqHelper::Parallel<Cut,Param> > & H){
+        if (!N) return C;
+        if (!K || F.isZero(alpha)){
+            fscalin (F, N, N, beta, C, ldc);
+            return C;
+        }
+        if (H.recLevel < 0)
+            H.recLevel = Protected::WinogradSteps (F, std::min (N, K));
+
+        size_t q = size_t(1) << (H.recLevel+1);
+        size_t Ns = (N/q)*q;
+        size_t Ks = (K/q)*q;
+        if (!H.recLevel || !Ns || !Ks || H.parseq.numthreads() <= 1){
+            MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag> SH (F, (Ns && Ks) ? H.recLevel : 0);
+            return fsyrk (F, UpLo, trans, N, K, alpha, A, lda, beta, C, ldc, SH);
+        }
+
+            // find a, b such that a^2 + b^2 = -1 mod p
+        Givaro::Integer a,b;
+        Givaro::IntSqrtModDom<> ISM;
+        ISM.sumofsquaresmodprime (a, b, -1, F.characteristic());
+        typename Field::Element y1, y2;
+        F.init (y1, a);
+        F.init (y2, b);
+
+        typename Field::ConstElement_ptr A12, A21;
+        if (trans==FflasNoTrans){
+            A12 = A + Ks; A21 = A + Ns*lda;
+        } else {
+            A12 = A + Ks*lda; A21 = A + Ns;
+        }
+            // C11 = A11 x A11^T
+        fsyrk_strassen (F, UpLo, trans, Ns, Ks, y1, y2, alpha, A, lda, beta, C, ldc, H);
+
+            // C11 += A12 x A12 ^T
+        if (K > Ks)
+            fsyrk (F, UpLo, trans, Ns, K-Ks, alpha, A12, lda, F.one, C, ldc);
+
+        if (N > Ns){
+                // C22 = [A21 A22] x [A21 A22]^T
+            fsyrk (F, UpLo, trans, N-Ns, K, alpha, A21, lda, beta, C+Ns*(ldc+1), ldc);
+
+                // C21 = A21 x A11^T
+            ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> psh (H.parseq.numthreads());
+            if (UpLo == FflasLower)
+                fgemm (F, trans, (trans == FflasNoTrans)? FflasTrans : FflasNoTrans, N-Ns, Ns, K,
+                       alpha, A21, lda, A, lda, beta, C+Ns*ldc, ldc, psh);
+            else
+                fgemm (F, trans, (trans == FflasNoTrans)? FflasTrans : FflasNoTrans, Ns, N-Ns, K,
+                       alpha, A, lda, A21, lda, beta, C+Ns, ldc, psh);
+        }
+        return C;
+    }
+
+    namespace Protected {
+            // C <- alpha A x D x A^T + beta C and A <- A x D (or the transposed variant), for D diagonal.
+            // Writing each d_i as s_i^2, or as c.t_i^2 for c a fixed quadratic non-residue, gives
+            // A x D x A^T = W1 x W1^T + c.W2 x W2^T, where W1 (resp. W2) gathers the columns s_i.A_i
+            // (resp. t_i.A_i): both products then run the parallel Strassen-like fsyrk.
+        template<class Field, class Cut, class Param>
+        inline typename Field::Element_ptr
+        fsyrk_strassen (const Field& F,
+                        const FFLAS_UPLO UpLo,
+                        const FFLAS_TRANSPOSE trans,
+                        const size_t N,
+                        const size_t K,
+                        const typename Field::Element alpha,
+                        typename Field::Element_ptr A, const size_t lda,
+                        typename Field::ConstElement_ptr D, const size_t incD,
+                        const typename Field::Element beta,
+                        typename Field::Element_ptr C, const size_t ldc,
+                        const ParSeqHelper::Parallel<Cut,Param> par,
+                        const int recLevel,
+                        ModeCategories::DelayedTag){
+            if (!N) return C;
+            size_t incRow,incCol;
+            if (trans==FflasNoTrans) {incRow=lda;incCol=1;}
+            else {incRow = 1; incCol = lda;}
+
+            Givaro::IntSqrtModDom<> ISM;
+            Givaro::Integer p (F.characteristic());
+            Givaro::Integer e ((p-1)/2), c(2), r, s, di;
+                // smallest quadratic non-residue
+            if (p > 2)
+                for (powmod (r, c, e, p); r != p-1; powmod (r, c, e, p))
+                    c += 1;
+            typename Field::Element cF, ci;
+            F.init (cF, c);
+
+            std::vector<typename Field::Element> roots (K);
+            std::vector<bool> square (K);
+            size_t K1 = 0;
+            for (size_t i=0; i<K; ++i){
+                F.convert (di, D[i*incD]);
+                if (di < 0) di += p;
+                if (di == 0 || p == 2){
+                    s = di;
+                    square[i] = true;
+                } else {
+                    powmod (r, di, e, p);
+                    square[i] = (r == 1);
+                    if (!square[i]){
+                        F.div (ci, D[i*incD], cF);
+                        F.convert (di, ci);
+                        if (di < 0) di += p;
+                    }
+                    ISM.sqrootmodprime (s, di, p);
+                }
+                if (square[i]) K1++;
+                F.init (roots[i], s);
+            }
+            size_t K2 = K - K1;
+
+                // W1 and W2 have the layout of A
+            size_t ldw1 = (trans == FflasNoTrans) ? K1 : N;
+            size_t ldw2 = (trans == FflasNoTrans) ? K2 : N;
+            size_t incRowW1 = (trans == FflasNoTrans) ? ldw1 : 1, incColW1 = (trans == FflasNoTrans) ? 1 : ldw1;
+            size_t incRowW2 = (trans == FflasNoTrans) ? ldw2 : 1, incColW2 = (trans == FflasNoTrans) ? 1 : ldw2;
+            typename Field::Element_ptr W1 = fflas_new (F, N*K1);
+            typename Field::Element_ptr W2 = fflas_new (F, N*K2);
+            typename Field::Element_ptr W1i = W1, W2i = W2;
+            for (size_t i=0; i<K; ++i)
+                if (square[i]){
+                    fscal (F, N, roots[i], A + i*incCol, incRow, W1i, incRowW1);
+                    W1i += incColW1;
+                } else {
+                    fscal (F, N, roots[i], A + i*incCol, incRow, W2i, incRowW2);
+                    W2i += incColW2;
+                }
+            for (size_t i=0; i<K; ++i)
+                fscalin (F, N, D[i*incD], A + i*incCol, incRow);
+
+            MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, ParSeqHelper::Parallel<Cut,Param> > H1 (F, recLevel, par);
+            fsyrk (F, UpLo, trans, N, K1, alpha, W1, ldw1, beta, C, ldc, H1);
+            if (K2){
+                typename Field::Element alphac;
+                F.init (alphac);
+                F.mul (alphac, alpha, cF);
+                MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, ParSeqHelper::Parallel<Cut,Param> > H2 (F, recLevel, par);
+                fsyrk (F, UpLo, trans, N, K2, alphac, W2, ldw2, F.one, C, ldc, H2);
+            }
+            fflas_delete (W1, W2);
+            return C;
+        }
+
+            // Fields without delayed reductions: classic recursive split
+        template<class Field, class Cut, class Param, class Mode>
+        inline typename Field::Element_ptr
+        fsyrk_strassen (const Field& F,
+                        const FFLAS_UPLO UpLo,
+                        const FFLAS_TRANSPOSE trans,
+                        const size_t N,
+                        const size_t K,
+                        const typename Field::Element alpha,
+                        typename Field::Element_ptr A, const size_t lda,
+                        typename Field::ConstElement_ptr D, const size_t incD,
+                        const typename Field::Element beta,
+                        typename Field::Element_ptr C, const size_t ldc,
+                        const ParSeqHelper::Parallel<Cut,Param> par,
+                        const int recLevel,
+                        Mode){
+            return fsyrk (F, UpLo, trans, N, K, alpha, A, lda, D, incD, beta, C, ldc, par);
+        }
+    }
+
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fsyrk_strassen (const Field& F,
+                    const FFLAS_UPLO UpLo,
+                    const FFLAS_TRANSPOSE trans,
+                    const size_t N,
+                    const size_t K,
+                    const typename Field::Element alpha,
+                    typename Field::Element_ptr A, const size_t lda,
+                    typename Field::ConstElement_ptr D, const size_t incD,
+                    const typename Field::Element beta,
+                    typename Field::Element_ptr C, const size_t ldc,
+                    const ParSeqHelper::Parallel<Cut,Param> par,
+                    const int recLevel){
+        return Protected::fsyrk_strassen (F, UpLo, trans, N, K, alpha, A, lda, D, incD, beta, C, ldc, par, recLevel,
+                                          typename ModeTraits<Field>::value());
+    }
 }
 
 
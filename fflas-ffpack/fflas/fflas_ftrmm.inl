@@ -181,6 +181,73 @@ namespace FFLAS {
             fscalin(F,M,N,alpha,C,ldc);
 
     }
+
+    template<class Field>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::Element_ptr B, const size_t ldb,
+           const ParSeqHelper::Sequential&)
+    {
+        ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::Element_ptr B, const size_t ldb,
+           const ParSeqHelper::Parallel<Cut,Param>& PSH)
+    {
+        TRMMHelper<StructureHelper::Recursive, ParSeqHelper::Parallel<Cut,Param> > H(PSH);
+        ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb, H);
+    }
+
+    template<class Field>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::ConstElement_ptr B, const size_t ldb,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           const ParSeqHelper::Sequential&)
+    {
+        ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::ConstElement_ptr B, const size_t ldb,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           const ParSeqHelper::Parallel<Cut,Param>& PSH)
+    {
+        TRMMHelper<StructureHelper::Iterative, ParSeqHelper::Parallel<Cut,Param> > H(PSH);
+        ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb, beta, C, ldc, H);
+    }
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
     namespace Protected {
@@ -118,6 +118,9 @@ namespace FFLAS {
            TRSMHelper<StructureHelper::Recursive, ParSeqTrait> & H)
     {
         if (!M || !N ) return;
+        FFLASFFPACK_INSTRUMENT(ftrsm, double(M)*double(N)*double(Side==FflasLeft ? M : N),
+                               sizeof(typename Field::Element)*(double(Side==FflasLeft ? M : N)*double(Side==FflasLeft ? M : N)/2.
+                                                                +2.*double(M)*double(N)));
 
         if ( Side==FflasLeft ){
             if ( Uplo==FflasUpper){
@@ -0,0 +1,431 @@
+/* fflas/fflas_gf2.inl
+ * Copyright (C) 2019 FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_fflas_gf2_INL
+#define __FFLASFFPACK_fflas_gf2_INL
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+#include "fflas-ffpack/field/field-traits.h"
+#include "fflas-ffpack/fflas/fflas_simd.h"
+#include "fflas-ffpack/utils/bit_manipulation.h"
+
+namespace FFLAS {
+
+    /** A dense matrix over GF(2), whose rows are packed in 64 bits words: the entry (i,j) is the
+     * bit j%64 of the word j/64 of the row i. The rows are padded to a whole number of simd
+     * vectors, and the padding bits are always zero.
+     */
+    class GF2Matrix {
+    public:
+        typedef uint64_t word;
+        static const size_t wordsize = 64;
+
+        /// The zero matrix of dimension m x n
+        GF2Matrix (const size_t m = 0, const size_t n = 0) { resize (m, n); }
+
+        size_t rowdim() const { return _m; }
+        size_t coldim() const { return _n; }
+        /// Number of words of each row
+        size_t stride() const { return _stride; }
+
+        word * row (const size_t i) { return _data.data() + i*_stride; }
+        const word * row (const size_t i) const { return _data.data() + i*_stride; }
+
+        bool get (const size_t i, const size_t j) const
+        {
+            return (row(i)[j/wordsize] >> (j%wordsize)) & 1;
+        }
+        void set (const size_t i, const size_t j, const bool b)
+        {
+            const word mask = word(1) << (j%wordsize);
+            if (b) row(i)[j/wordsize] |= mask;
+            else row(i)[j/wordsize] &= ~mask;
+        }
+
+        /// Resets to the zero matrix of dimension m x n
+        void resize (const size_t m, const size_t n)
+        {
+            const size_t vs = Simd<int64_t>::vect_size;
+            _m = m;
+            _n = n;
+            _stride = ((n + wordsize - 1) / wordsize + vs - 1) / vs * vs;
+            _data.assign (_m*_stride, 0);
+        }
+
+        void zero() { std::fill (_data.begin(), _data.end(), 0); }
+
+        /// Packs op(A), an m x n matrix over a field of cardinality 2
+        template<class Field>
+        void setMatrix (const Field& F, typename Field::ConstElement_ptr A, const size_t lda,
+                        const FFLAS_TRANSPOSE ta = FflasNoTrans)
+        {
+            // each word is assembled in a register from its 64 entries, then stored once
+            const size_t nw = (_n + wordsize - 1) / wordsize;
+            if (ta == FflasNoTrans){
+                for (size_t i = 0; i < _m; ++i){
+                    word * r = row (i);
+                    for (size_t w = 0; w < nw; ++w){
+                        typename Field::ConstElement_ptr a = A + i*lda + w*wordsize;
+                        const size_t nb = std::min (wordsize, _n - w*wordsize);
+                        word x = 0;
+                        for (size_t b = 0; b < nb; ++b)
+                            x |= word (!F.isZero (a[b])) << b;
+                        r[w] = x;
+                    }
+                    std::fill (r+nw, r+_stride, 0);
+                }
+            } else {
+                // the word w of the rows of op(A) gathers 64 rows of A, which are read along
+                // their entries while the rows of op(A) are filled one after the other
+                for (size_t w = 0; w < nw; ++w){
+                    typename Field::ConstElement_ptr a = A + w*wordsize*lda;
+                    const size_t nb = std::min (wordsize, _n - w*wordsize);
+                    for (size_t i = 0; i < _m; ++i){
+                        word x = 0;
+                        for (size_t b = 0; b < nb; ++b)
+                            x |= word (!F.isZero (a[b*lda+i])) << b;
+                        row (i)[w] = x;
+                    }
+                }
+                for (size_t i = 0; i < _m; ++i)
+                    std::fill (row (i)+nw, row (i)+_stride, 0);
+            }
+        }
+
+        /// Unpacks the matrix in A, an m x n matrix over a field of cardinality 2
+        template<class Field>
+        void getMatrix (const Field& F, typename Field::Element_ptr A, const size_t lda) const
+        {
+            // the reduced form of one, as the floating point routines return it (-1 over a
+            // ModularBalanced field)
+            typename Field::Element v[2];
+            F.assign (v[0], F.zero);
+            F.mul (v[1], F.one, F.one);
+            const size_t nw = (_n + wordsize - 1) / wordsize;
+            for (size_t i = 0; i < _m; ++i){
+                const word * r = row (i);
+                for (size_t w = 0; w < nw; ++w){
+                    typename Field::Element_ptr a = A + i*lda + w*wordsize;
+                    const size_t nb = std::min (wordsize, _n - w*wordsize);
+                    const word x = r[w];
+                    for (size_t b = 0; b < nb; ++b)
+                        F.assign (a[b], v[(x >> b) & 1]);
+                }
+            }
+        }
+
+    private:
+        size_t _m, _n, _stride;
+        std::vector<word> _data;
+    };
+
+    namespace Protected {
+
+        // a <- a + b over nw words
+        inline void gf2_addin (GF2Matrix::word * a, const GF2Matrix::word * b, const size_t nw)
+        {
+            size_t i = 0;
+#ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
+            using simd = Simd<int64_t>;
+            int64_t * ai = reinterpret_cast<int64_t*> (a);
+            const int64_t * bi = reinterpret_cast<const int64_t*> (b);
+            for (; i + simd::vect_size <= nw; i += simd::vect_size)
+                simd::storeu (ai+i, simd::vxor (simd::loadu (ai+i), simd::loadu (bi+i)));
+#endif
+            for (; i < nw; ++i)
+                a[i] ^= b[i];
+        }
+
+        // c <- a + b over nw words
+        inline void gf2_add (GF2Matrix::word * c, const GF2Matrix::word * a, const GF2Matrix::word * b,
+                             const size_t nw)
+        {
+            size_t i = 0;
+#ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
+            using simd = Simd<int64_t>;
+            int64_t * ci = reinterpret_cast<int64_t*> (c);
+            const int64_t * ai = reinterpret_cast<const int64_t*> (a);
+            const int64_t * bi = reinterpret_cast<const int64_t*> (b);
+            for (; i + simd::vect_size <= nw; i += simd::vect_size)
+                simd::storeu (ci+i, simd::vxor (simd::loadu (ai+i), simd::loadu (bi+i)));
+#endif
+            for (; i < nw; ++i)
+                c[i] = a[i] ^ b[i];
+        }
+
+        // The 8 bits of the columns j..j+7 of a packed row, j being a multiple of 8
+        inline unsigned gf2_byte (const GF2Matrix::word * r, const size_t j)
+        {
+            return (r[j/GF2Matrix::wordsize] >> (j%GF2Matrix::wordsize)) & 0xFF;
+        }
+
+        /* Number of words of the column slices of the tables of the Four Russians: the 8 tables of
+         * a pass, of 256 slices each, take 8*256*8*gf2_table_words bytes and must stay in L2.
+         */
+        const size_t gf2_table_words = 32;
+        // Number of rows of C of a tile: a tile takes 8*gf2_table_words*gf2_tile_rows bytes
+        const size_t gf2_tile_rows = 2048;
+
+        /* T <- the 2^kb sums of the rows i0..i0+kb-1 of B, restricted to the words w0..w0+nw-1:
+         * the row s of T is the sum of the rows i0+t of B such that the bit t of s is set.
+         * The table is filled in Gray code order, so that each entry is one addition away from the
+         * previous one, which is still in L1.
+         */
+        inline void gf2_combinations (const GF2Matrix& B, const size_t i0, const size_t kb,
+                                      const size_t w0, const size_t nw, GF2Matrix::word * T)
+        {
+            const size_t ns = size_t(1) << kb;
+            std::fill (T, T+nw, 0);
+            for (size_t s = 1, prev = 0; s < ns; ++s){
+                const size_t g = s ^ (s >> 1);
+                gf2_add (T+g*nw, T+prev*nw, B.row (i0+ctz (uint64_t(s)))+w0, nw);
+                prev = g;
+            }
+        }
+
+        inline void gf2_combinations (const GF2Matrix& B, const size_t i0, const size_t kb,
+                                      const size_t w0, const size_t nw, std::vector<GF2Matrix::word>& T)
+        {
+            T.resize ((size_t(1) << kb)*nw);
+            gf2_combinations (B, i0, kb, w0, nw, T.data());
+        }
+
+        /* The tables of the combinations of the rows i0..i0+kb-1 of B, kb <= 64, by slices of 8
+         * rows: the table t, at T+256*nw*t, holds the combinations of the rows i0+8t..i0+8t+7.
+         * Returns the number of tables.
+         */
+        inline size_t gf2_tables (const GF2Matrix& B, const size_t i0, const size_t kb,
+                                  const size_t w0, const size_t nw, std::vector<GF2Matrix::word>& T)
+        {
+            const size_t ntab = (kb + 7) / 8;
+            T.resize (ntab*256*nw);
+            for (size_t t = 0; t < ntab; ++t)
+                gf2_combinations (B, i0+8*t, std::min (size_t(8), kb-8*t), w0, nw, T.data()+t*256*nw);
+            return ntab;
+        }
+
+        // c <- c + Ts[0] + ... + Ts[nt-1] over nw words: each vector of c is loaded and stored once
+        inline void gf2_addin_sum (GF2Matrix::word * c, const GF2Matrix::word * const * Ts, const size_t nt,
+                                   const size_t nw)
+        {
+            if (nt != 8){
+                for (size_t t = 0; t < nt; ++t)
+                    gf2_addin (c, Ts[t], nw);
+                return;
+            }
+            size_t i = 0;
+#ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
+            using simd = Simd<int64_t>;
+            int64_t * ci = reinterpret_cast<int64_t*> (c);
+            const int64_t * T[8];
+            for (size_t t = 0; t < 8; ++t) T[t] = reinterpret_cast<const int64_t*> (Ts[t]);
+            for (; i + simd::vect_size <= nw; i += simd::vect_size){
+                const typename simd::vect_t u = simd::vxor (simd::vxor (simd::loadu (T[0]+i), simd::loadu (T[1]+i)),
+                                                            simd::vxor (simd::loadu (T[2]+i), simd::loadu (T[3]+i)));
+                const typename simd::vect_t v = simd::vxor (simd::vxor (simd::loadu (T[4]+i), simd::loadu (T[5]+i)),
+                                                            simd::vxor (simd::loadu (T[6]+i), simd::loadu (T[7]+i)));
+                simd::storeu (ci+i, simd::vxor (simd::loadu (ci+i), simd::vxor (u, v)));
+            }
+#endif
+            for (; i < nw; ++i)
+                c[i] ^= Ts[0][i] ^ Ts[1][i] ^ Ts[2][i] ^ Ts[3][i] ^ Ts[4][i] ^ Ts[5][i] ^ Ts[6][i] ^ Ts[7][i];
+        }
+
+        /* c <- c + the sum over t < ntab of the entry of the table t, as given by gf2_tables,
+         * selected by the byte t of a (the entry 0, which is zero, being added as any other)
+         */
+        inline void gf2_addin_tables (GF2Matrix::word * c, const GF2Matrix::word * T, const size_t ntab,
+                                      const GF2Matrix::word a, const size_t nw)
+        {
+            const GF2Matrix::word * Ts[8];
+            for (size_t t = 0; t < ntab; ++t)
+                Ts[t] = T + (t*256 + ((a >> (8*t)) & 0xFF))*nw;
+            gf2_addin_sum (c, Ts, ntab, nw);
+        }
+
+    } // Protected
+
+    /** C <- A B (or C <- A B + C if accumulate) over GF(2), by the method of the Four Russians, as
+     * in M4RI: each slice of 64 rows of B is expanded in 8 tables of the 256 combinations of 8
+     * rows, and a row of C is then updated by the 8 table entries selected by the corresponding
+     * word of the row of A, in a single pass over the row.
+     * C is processed by tiles of gf2_tile_rows rows and gf2_table_words words, so that the tile
+     * and the tables stay in L2 while the rows of B are scanned.
+     */
+    inline GF2Matrix&
+    fgemm (const GF2Matrix& A, const GF2Matrix& B, GF2Matrix& C, const bool accumulate = false)
+    {
+        if (A.coldim() != B.rowdim() || C.rowdim() != A.rowdim() || C.coldim() != B.coldim())
+            throw std::invalid_argument ("fgemm over GF(2): dimensions do not match");
+        if (!accumulate) C.zero();
+        const size_t m = A.rowdim(), k = A.coldim(), ws = GF2Matrix::wordsize;
+        std::vector<GF2Matrix::word> T;
+        for (size_t i0 = 0; i0 < m; i0 += Protected::gf2_tile_rows){
+            const size_t i1 = std::min (m, i0+Protected::gf2_tile_rows);
+            for (size_t w0 = 0; w0 < B.stride(); w0 += Protected::gf2_table_words){
+                const size_t nw = std::min (Protected::gf2_table_words, B.stride()-w0);
+                for (size_t l = 0; l < k; l += ws){
+                    const size_t ntab = Protected::gf2_tables (B, l, std::min (ws, k-l), w0, nw, T);
+                    for (size_t i = i0; i < i1; ++i){
+                        // the padding bits of A beyond k are zero
+                        const GF2Matrix::word a = A.row (i)[l/ws];
+                        if (a) Protected::gf2_addin_tables (C.row (i)+w0, T.data(), ntab, a, nw);
+                    }
+                }
+            }
+        }
+        return C;
+    }
+
+    /** B <- A^{-1} B over GF(2), where A is the M x M lower (Uplo==FflasLower) or upper
+     * (Uplo==FflasUpper) triangular block at the top left of A, with M = B.rowdim().
+     * The diagonal of an invertible triangular matrix over GF(2) is one, hence it is not read, and
+     * the entries of A outside the triangle are ignored (e.g. L or U in the L\U storage of PLUQ).
+     * The solution is computed by slices of 64 rows: inside a slice, by slices of 8 rows applied
+     * through one table each, and the 64 solved rows are then applied to the remaining rows of B
+     * through 8 tables, as in fgemm.
+     */
+    inline GF2Matrix&
+    ftrsm (const FFLAS_UPLO Uplo, const GF2Matrix& A, GF2Matrix& B)
+    {
+        const size_t M = B.rowdim(), ws = GF2Matrix::wordsize;
+        if (A.rowdim() < M || A.coldim() < M)
+            throw std::invalid_argument ("ftrsm over GF(2): dimensions do not match");
+        std::vector<GF2Matrix::word> T;
+        for (size_t w0 = 0; w0 < B.stride(); w0 += Protected::gf2_table_words){
+            const size_t nw = std::min (Protected::gf2_table_words, B.stride()-w0);
+            if (Uplo == FflasLower){
+                for (size_t L = 0; L < M; L += ws){
+                    const size_t Lb = std::min (ws, M-L);
+                    for (size_t l = L; l < L+Lb; l += 8){
+                        const size_t kb = std::min (size_t(8), L+Lb-l);
+                        for (size_t i = l+1; i < l+kb; ++i)
+                            for (size_t j = l; j < i; ++j)
+                                if (A.get (i, j)) Protected::gf2_addin (B.row (i)+w0, B.row (j)+w0, nw);
+                        if (l+kb == L+Lb) break;
+                        Protected::gf2_combinations (B, l, kb, w0, nw, T);
+                        // kb = 8 here: the whole byte lies in the lower triangle
+                        for (size_t i = l+kb; i < L+Lb; ++i){
+                            const unsigned s = Protected::gf2_byte (A.row (i), l);
+                            if (s) Protected::gf2_addin (B.row (i)+w0, T.data()+s*nw, nw);
+                        }
+                    }
+                    if (L+Lb == M) break;
+                    // Lb = 64 here: the whole word lies in the lower triangle
+                    const size_t ntab = Protected::gf2_tables (B, L, Lb, w0, nw, T);
+                    for (size_t i = L+Lb; i < M; ++i){
+                        const GF2Matrix::word a = A.row (i)[L/ws];
+                        if (a) Protected::gf2_addin_tables (B.row (i)+w0, T.data(), ntab, a, nw);
+                    }
+                }
+            } else {
+                for (size_t L = ((M+ws-1)/ws)*ws; L > 0; ){
+                    L -= ws;
+                    const size_t Lb = std::min (ws, M-L);
+                    for (size_t l = L+((Lb+7)/8)*8; l > L; ){
+                        l -= 8;
+                        const size_t kb = std::min (size_t(8), M-l);
+                        for (size_t i = l+kb-1; i > l; ){
+                            --i;
+                            for (size_t j = i+1; j < l+kb; ++j)
+                                if (A.get (i, j)) Protected::gf2_addin (B.row (i)+w0, B.row (j)+w0, nw);
+                        }
+                        if (l == L) break;
+                        Protected::gf2_combinations (B, l, kb, w0, nw, T);
+                        const unsigned mask = (1u << kb) - 1;
+                        for (size_t i = L; i < l; ++i){
+                            const unsigned s = Protected::gf2_byte (A.row (i), l) & mask;
+                            if (s) Protected::gf2_addin (B.row (i)+w0, T.data()+s*nw, nw);
+                        }
+                    }
+                    if (!L) break;
+                    // the columns of A beyond M, in the last word, are not part of the triangle
+                    const GF2Matrix::word mask = (Lb == ws) ? ~GF2Matrix::word(0) : (GF2Matrix::word(1) << Lb) - 1;
+                    const size_t ntab = Protected::gf2_tables (B, L, Lb, w0, nw, T);
+                    for (size_t i = 0; i < L; ++i){
+                        const GF2Matrix::word a = A.row (i)[L/ws] & mask;
+                        if (a) Protected::gf2_addin_tables (B.row (i)+w0, T.data(), ntab, a, nw);
+                    }
+                }
+            }
+        }
+        return B;
+    }
+
+    namespace Protected {
+
+        // Whether the bit packed routines apply to a problem of smallest dimension d over F, from the
+        // dimension threshold (the multiprecision and RNS fields keep their own routines)
+        template<class Field>
+        inline bool useGF2 (const Field& F, const size_t d, const size_t threshold, FieldCategories::ModularTag)
+        {
+            return std::is_arithmetic<typename Field::Element>::value
+                && d >= threshold && F.cardinality() == 2;
+        }
+
+        template<class Field, class FieldCategory>
+        inline bool useGF2 (const Field&, const size_t, const size_t, FieldCategory)
+        {
+            return false;
+        }
+
+        template<class Field>
+        inline bool useGF2 (const Field& F, const size_t d, const size_t threshold = __FFLASFFPACK_GF2_THRESHOLD)
+        {
+            return useGF2 (F, d, threshold, typename FieldTraits<Field>::category());
+        }
+
+        /* C <- op(A) op(B) + beta C over a field of cardinality 2, with alpha = 1 (the only nonzero
+         * element), through the packed fgemm
+         */
+        template<class Field>
+        inline typename Field::Element_ptr
+        fgemm_gf2 (const Field& F, const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                   const size_t m, const size_t n, const size_t k,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::ConstElement_ptr B, const size_t ldb,
+                   const typename Field::Element beta,
+                   typename Field::Element_ptr C, const size_t ldc)
+        {
+            GF2Matrix GA (m, k), GB (k, n), GC (m, n);
+            GA.setMatrix (F, A, lda, ta);
+            GB.setMatrix (F, B, ldb, tb);
+            const bool accumulate = !F.isZero (beta);
+            if (accumulate) GC.setMatrix (F, C, ldc);
+            fgemm (GA, GB, GC, accumulate);
+            GC.getMatrix (F, C, ldc);
+            return C;
+        }
+
+    } // Protected
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_gf2_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -406,6 +406,20 @@ namespace FFLAS {
 
     };
 
+    /*! TRMM Helper
+     * Recursive splits the triangular operand with fgemm updates, Iterative splits the
+     * other operand into independent slabs.
+    */
+    template<typename RecIterTrait = StructureHelper::Recursive, typename ParSeqTrait = ParSeqHelper::Sequential>
+    struct TRMMHelper {
+        ParSeqTrait parseq;
+        template<class Cut,class Param>
+        TRMMHelper(ParSeqHelper::Parallel<Cut,Param> _PS):parseq(_PS){}
+        TRMMHelper(ParSeqHelper::Sequential _PS):parseq(_PS){}
+        template<typename RIT, typename PST>
+        TRMMHelper(TRMMHelper<RIT,PST>& _TH):parseq(_TH.parseq){}
+    };
+
 
 
 
@@ -74,7 +74,7 @@ namespace FFLAS { namespace Protected {
         kc=depth;
         FFLAS::details::BlockingFactor(mc,nc,kc);
         size_t sizeA = mc*kc;
-        size_t sizeB = kc*cols;
+        size_t sizeB = kc*nc;
 
         // these data must be simd::alignment byte aligned
         int64_t *blockA, *blockB;
@@ -83,36 +83,42 @@ namespace FFLAS { namespace Protected {
         blockA = fflas_new<int64_t>(sizeA, (Alignment)simd::alignment);
         blockB = fflas_new<int64_t>(sizeB, (Alignment)simd::alignment);
 
-        // For each horizontal panel of B, and corresponding vertical panel of A
-        for(size_t k2=0; k2<depth; k2+=kc){
+        // For each vertical panel of B and C
+        for(size_t j2=0; j2<cols; j2+=nc){
 
-            const size_t actual_kc = std::min(k2+kc,depth)-k2;
-            FFLASFFPACK_check(kc <= depth);
+            const size_t actual_nc = std::min(j2+nc,cols)-j2;
 
-            // pack horizontal panel of B into sequential memory (L2 cache)
-            if (tB == FflasNoTrans)
-                FFLAS::details::pack_rhs<_nr,false>(blockB, B+k2, ldb, actual_kc, cols);
-            else
-                FFLAS::details::pack_lhs<_nr,true>(blockB, B+k2*ldb, ldb, cols, actual_kc);
+            // For each horizontal panel of B, and corresponding vertical panel of A
+            for(size_t k2=0; k2<depth; k2+=kc){
 
-            // For each mc x kc block of the lhs's vertical panel...
-            for(size_t i2=0; i2<rows; i2+=mc){
+                const size_t actual_kc = std::min(k2+kc,depth)-k2;
+                FFLASFFPACK_check(kc <= depth);
 
-                const size_t actual_mc = std::min(i2+mc,rows)-i2;
+                // pack horizontal panel of B into sequential memory (L2 cache)
+                if (tB == FflasNoTrans)
+                    FFLAS::details::pack_rhs<_nr,false>(blockB, B+k2+j2*ldb, ldb, actual_kc, actual_nc);
+                else
+                    FFLAS::details::pack_lhs<_nr,true>(blockB, B+k2*ldb+j2, ldb, actual_nc, actual_kc);
 
+                // For each mc x kc block of the lhs's vertical panel...
+                for(size_t i2=0; i2<rows; i2+=mc){
 
-                FFLASFFPACK_check(mc <= rows);
-                // pack a chunk of the vertical panel of A into a sequential memory (L1 cache)
-                if (tA == FflasNoTrans)
-                    FFLAS::details::pack_lhs<_mr,false>(blockA, A+i2+k2*lda, lda, actual_mc, actual_kc);
-                else
-                    FFLAS::details::pack_rhs<_mr,true>(blockA, A+i2*lda+k2, lda, actual_kc, actual_mc);
+                    const size_t actual_mc = std::min(i2+mc,rows)-i2;
+
+
+                    FFLASFFPACK_check(mc <= rows);
+                    // pack a chunk of the vertical panel of A into a sequential memory (L1 cache)
+                    if (tA == FflasNoTrans)
+                        FFLAS::details::pack_lhs<_mr,false>(blockA, A+i2+k2*lda, lda, actual_mc, actual_kc);
+                    else
+                        FFLAS::details::pack_rhs<_mr,true>(blockA, A+i2*lda+k2, lda, actual_kc, actual_mc);
 
-                // call block*panel kernel
-                FFLAS::details::igebp<alpha_kind>(actual_mc, cols, actual_kc
-                                                  , alpha
-                                                  , blockA, actual_kc, blockB, actual_kc
-                                                  , C+i2, ldc);
+                    // call block*panel kernel
+                    FFLAS::details::igebp<alpha_kind>(actual_mc, actual_nc, actual_kc
+                                                      , alpha
+                                                      , blockA, actual_kc, blockB, actual_kc
+                                                      , C+i2+j2*ldc, ldc);
+                }
             }
         }
 
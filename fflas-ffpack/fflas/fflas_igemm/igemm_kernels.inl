@@ -33,19 +33,16 @@
 #ifdef __FFLASFFPACK_HAVE_AVX512F_INSTRUCTIONS
 // Warning, _nr=4 is hardcoded in most routines below. Any other value  set here will cause failure.
 #define _nr 4 //nr and mr must be both multiples of simd::vect_size
-#define _mr 16
 #define _dr 4
 #define StepA 8
 #define StepB 8
 #elif __FFLASFFPACK_HAVE_AVX2_INSTRUCTIONS
 #define _nr 4
-#define _mr 8
 #define _dr 4
 #define StepA 4
 #define StepB 4
 #elif defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS) or defined(__FFLASFFPACK_HAVE_AVX_INSTRUCTIONS)
 #define _nr 4
-#define _mr 4
 #define _dr 4
 #define StepA 2
 #define StepB 2
@@ -53,6 +50,12 @@
 #error "kernels not supported"
 #endif // __FFLASFFPACK_HAVE_AVX2_INSTRUCTIONS
 
+// _mr rows of one or two simd vectors: the micro-kernel is igebb44 or igebb24
+#if __FFLASFFPACK_IGEMM_MR_VECTORS != 1 && __FFLASFFPACK_IGEMM_MR_VECTORS != 2
+#error "__FFLASFFPACK_IGEMM_MR_VECTORS must be 1 or 2"
+#endif
+#define _mr (__FFLASFFPACK_IGEMM_MR_VECTORS*StepA)
+
 #include "fflas-ffpack/utils/fflas_memory.h"
 #include "igemm_tools.h"
 
@@ -611,7 +614,10 @@ namespace FFLAS { namespace details { /*  main */
             for (i=0;i<prows;i+=_mr){
                 const int64_t* blA = blockA+i*lda;
                 prefetch(blA);
-                igebb44<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
+                if (_mr == 2*StepA)
+                    igebb44<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
+                else
+                    igebb24<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
             }
             i=prows;
             // process the (rows%_mr) remainings rows
@@ -635,7 +641,10 @@ namespace FFLAS { namespace details { /*  main */
             for (i=0;i<prows;i+=_mr){
                 const int64_t* blA = blockA+i*lda;
                 prefetch(blA);
-                igebb41<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
+                if (_mr == 2*StepA)
+                    igebb41<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
+                else
+                    igebb21<K>(i, j, depth, pdepth, alpha, blA, blockB+j*ldb, C, ldc);
             }
             i=prows;
             // process the (rows%_mr) remainings rows
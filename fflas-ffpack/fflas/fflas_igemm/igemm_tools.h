@@ -44,6 +44,19 @@ namespace FFLAS { namespace details { /*  tools */
     void gebp(size_t rows, size_t cols, size_t depth,int64_t* C, size_t ldc, const int64_t* blockA, size_t lda,
               const int64_t* BlockB, size_t ldb, int64_t* BlockW);
 
+    /** Blocking factors of igemm.
+     * A zero factor is computed from the cache sizes by BlockingFactor;
+     * they default to __FFLASFFPACK_IGEMM_MC, __FFLASFFPACK_IGEMM_KC and __FFLASFFPACK_IGEMM_NC,
+     * as set by autotune/igemm.C.
+     */
+    struct IgemmBlocking {
+        size_t mc, kc, nc;
+    };
+
+    IgemmBlocking& igemmBlocking();
+
+    void BlockingFactorHeuristic(size_t& m, size_t& n, size_t& k);
+
     void BlockingFactor(size_t& m, size_t& n, size_t& k);
 
 
@@ -106,7 +106,13 @@ namespace FFLAS { namespace details {
 
     }
 
-    inline void BlockingFactor(size_t& m, size_t& n, size_t& k)
+    inline IgemmBlocking& igemmBlocking()
+    {
+        static IgemmBlocking blocking = { __FFLASFFPACK_IGEMM_MC, __FFLASFFPACK_IGEMM_KC, __FFLASFFPACK_IGEMM_NC };
+        return blocking;
+    }
+
+    inline void BlockingFactorHeuristic(size_t& m, size_t& n, size_t& k)
     {
         int l1, l2, l3, tlb;
         queryCacheSizes(l1,l2,l3);
@@ -134,6 +140,21 @@ namespace FFLAS { namespace details {
         //cout<<"kc="<<k<<endl;
     }
 
+    // m, n, k are the dimensions on input and the blocking factors mc, nc, kc on output
+    inline void BlockingFactor(size_t& m, size_t& n, size_t& k)
+    {
+        const IgemmBlocking& tuned = igemmBlocking();
+        size_t mc=m, nc=n, kc=k;
+        BlockingFactorHeuristic(mc,nc,kc);
+        if (tuned.kc) kc = std::min(k, tuned.kc);
+        if (tuned.mc) mc = std::min(m, tuned.mc);
+        // nc is kept a multiple of _nr, so that only the last panel of B has a remainder
+        if (tuned.nc) nc = std::min(n, std::max(size_t(_nr), (tuned.nc/_nr)*_nr));
+        m=mc;
+        n=nc;
+        k=kc;
+    }
+
 
 } // details
 } // FFLAS
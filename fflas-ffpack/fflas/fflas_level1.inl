@@ -113,6 +113,7 @@ namespace FFLAS {
               OtherElement_ptr X, const size_t incX,
               typename Field::ConstElement_ptr Y, const size_t incY)
     {
+        FFLASFFPACK_INSTRUMENT(fconvert, n, (sizeof(*X)+sizeof(typename Field::Element))*double(n));
         OtherElement_ptr Xi = X ;
         typename Field::ConstElement_ptr Yi = Y ;
         for (; Xi < X+n*incX; Xi+=incX, Yi += incY )
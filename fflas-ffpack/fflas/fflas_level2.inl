@@ -248,6 +248,7 @@ namespace FFLAS {
               OtherElement_ptr A, const size_t lda,
               typename Field::ConstElement_ptr B, const size_t ldb)
     {
+        FFLASFFPACK_INSTRUMENT(fconvert, double(m)*double(n), (sizeof(*A)+sizeof(typename Field::Element))*double(m)*double(n));
         //!@todo check if n == lda
         for (size_t i = 0 ; i < m ; ++i)
             fconvert(F,n,A+i*lda,1,B+i*ldb,1);
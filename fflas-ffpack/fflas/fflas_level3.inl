@@ -357,6 +357,27 @@ namespace FFLAS {
            typename Field::Element_ptr C, const size_t ldc,
            const ParSeqHelper::Parallel<Cut,Param> par,
            const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+    /** @brief  fsyrk_strassen: parallel Symmetric Rank K update with diagonal scaling
+     *
+     * Same as the above fsyrk, computed by the Strassen-like symmetric product of \p A
+     * scaled by the square roots of the coefficients of \p D, in parallel.
+     * @param recLevel number of recursive levels of the Strassen-like product, -1 to choose it from the dimensions
+     * @warning the field must be prime and support delayed reductions
+     */
+    template<class Field, class Cut, class Param>
+    typename Field::Element_ptr
+    fsyrk_strassen (const Field& F,
+                    const FFLAS_UPLO UpLo,
+                    const FFLAS_TRANSPOSE trans,
+                    const size_t n,
+                    const size_t k,
+                    const typename Field::Element alpha,
+                    typename Field::Element_ptr A, const size_t lda,
+                    typename Field::ConstElement_ptr D, const size_t incD,
+                    const typename Field::Element beta,
+                    typename Field::Element_ptr C, const size_t ldc,
+                    const ParSeqHelper::Parallel<Cut,Param> par,
+                    const int recLevel = -1);
     /** @brief  fsyrk: Symmetric Rank K update with diagonal scaling
      *
      * Computes the Lower or Upper triangular part of
@@ -396,6 +417,21 @@ namespace FFLAS {
            const std::vector<bool>& twoBlock,
            const typename Field::Element beta,
            typename Field::Element_ptr C, const size_t ldc, const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+    template<class Field, class Cut, class Param>
+    typename Field::Element_ptr
+    fsyrk (const Field& F,
+           const FFLAS_UPLO UpLo,
+           const FFLAS_TRANSPOSE trans,
+           const size_t n,
+           const size_t k,
+           const typename Field::Element alpha,
+           typename Field::Element_ptr A, const size_t lda,
+           typename Field::ConstElement_ptr D, const size_t incD,
+           const std::vector<bool>& twoBlock,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           const ParSeqHelper::Parallel<Cut,Param> par,
+           const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
 
     /** @brief  fsyr2k: Symmetric Rank 2K update
      *
@@ -425,6 +461,19 @@ namespace FFLAS {
             typename Field::ConstElement_ptr B, const size_t ldb,
             const typename Field::Element beta,
             typename Field::Element_ptr C, const size_t ldc);
+    template<class Field, class Cut, class Param>
+    typename Field::Element_ptr
+    fsyr2k (const Field& F,
+            const FFLAS_UPLO UpLo,
+            const FFLAS_TRANSPOSE trans,
+            const size_t n,
+            const size_t k,
+            const typename Field::Element alpha,
+            typename Field::ConstElement_ptr A, const size_t lda,
+            typename Field::ConstElement_ptr B, const size_t ldb,
+            const typename Field::Element beta,
+            typename Field::Element_ptr C, const size_t ldc,
+            const ParSeqHelper::Parallel<Cut,Param> par);
 
     /** @brief  fgemm: <b>F</b>ield <b>GE</b>neral <b>M</b>atrix <b>M</b>ultiply.
      *
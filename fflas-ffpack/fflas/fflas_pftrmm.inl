@@ -0,0 +1,176 @@
+/* fflas/fflas_pftrmm.inl
+ * Copyright (C) 2019 FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+
+#ifndef __FFLASFFPACK_fflas_pftrmm_INL
+#define __FFLASFFPACK_fflas_pftrmm_INL
+
+// order of the triangular operand below which the recursive parallel ftrmm splits B into slabs
+#ifndef PTRMM_RECURSIVE_THRESHOLD
+#define PTRMM_RECURSIVE_THRESHOLD 256
+#endif
+
+#include "fflas-ffpack/paladin/parallel.h"
+
+namespace FFLAS {
+
+    // Splits B into independent slabs of rows (Side==FflasRight) or columns (Side==FflasLeft),
+    // each one multiplied by A sequentially in a task
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::Element_ptr B, const size_t ldb,
+           TRMMHelper <StructureHelper::Iterative, ParSeqHelper::Parallel<Cut,Param> > & H)
+    {
+        if (!M || !N ) return;
+        SYNCH_GROUP(
+                    if(Side == FflasRight){
+                    FORBLOCK1D(iter, M, H.parseq,
+                               TASK(MODE(READ(A[0]) CONSTREFERENCE(F, A, B) READWRITE(B[iter.begin()*ldb])),
+                                    ftrmm (F, Side, Uplo, TransA, Diag, iter.end()-iter.begin(), N, alpha, A, lda, B + iter.begin()*ldb, ldb));
+                              );
+                    } else {
+                    FORBLOCK1D(iter, N, H.parseq,
+                               TASK(MODE(READ(A[0]) CONSTREFERENCE(F, A, B) READWRITE(B[iter.begin()])),
+                                    ftrmm (F, Side, Uplo, TransA, Diag, M, iter.end()-iter.begin(), alpha, A, lda, B + iter.begin(), ldb));
+                              );
+                    }
+                   );
+    }
+
+    // C <- alpha op(A) B + beta C (or alpha B op(A) + beta C): B and C are split into independent
+    // slabs of rows (Side==FflasRight) or columns (Side==FflasLeft), each one computed
+    // sequentially in a task
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::ConstElement_ptr B, const size_t ldb,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc,
+           TRMMHelper <StructureHelper::Iterative, ParSeqHelper::Parallel<Cut,Param> > & H)
+    {
+        if (!M || !N ) return;
+        SYNCH_GROUP(
+                    if(Side == FflasRight){
+                    FORBLOCK1D(iter, M, H.parseq,
+                               TASK(MODE(READ(A[0], B[iter.begin()*ldb]) CONSTREFERENCE(F, A, B, C) READWRITE(C[iter.begin()*ldc])),
+                                    ftrmm (F, Side, Uplo, TransA, Diag, iter.end()-iter.begin(), N, alpha, A, lda,
+                                           B + iter.begin()*ldb, ldb, beta, C + iter.begin()*ldc, ldc));
+                              );
+                    } else {
+                    FORBLOCK1D(iter, N, H.parseq,
+                               TASK(MODE(READ(A[0], B[iter.begin()]) CONSTREFERENCE(F, A, B, C) READWRITE(C[iter.begin()])),
+                                    ftrmm (F, Side, Uplo, TransA, Diag, M, iter.end()-iter.begin(), alpha, A, lda,
+                                           B + iter.begin(), ldb, beta, C + iter.begin(), ldc));
+                              );
+                    }
+                   );
+    }
+
+    // Splits the triangular operand op(A) = [ A1 A2 ] (or [ A1    ]) in halves: the off-diagonal
+    //                                       [    A3 ]     [ A2 A3 ]
+    // block is applied by a parallel fgemm, between the two recursive calls on the diagonal blocks.
+    // When op(A) is small, or B is wider than tall, B is split into slabs instead.
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrmm (const Field& F, const FFLAS_SIDE Side,
+           const FFLAS_UPLO Uplo,
+           const FFLAS_TRANSPOSE TransA,
+           const FFLAS_DIAG Diag,
+           const size_t M, const size_t N,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           typename Field::Element_ptr B, const size_t ldb,
+           TRMMHelper <StructureHelper::Recursive, ParSeqHelper::Parallel<Cut,Param> > & H)
+    {
+        if (!M || !N ) return;
+        const size_t nt = H.parseq.numthreads();
+        const size_t K = (Side == FflasLeft) ? M : N;     // order of A
+        const size_t W = (Side == FflasLeft) ? N : M;     // width of the slabs of B
+        if (nt <= 1){
+            ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+            return;
+        }
+        if (K <= PTRMM_RECURSIVE_THRESHOLD || W >= K){
+            ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> psh(nt);
+            TRMMHelper<StructureHelper::Iterative, ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> > IterH(psh);
+            ftrmm (F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb, IterH);
+            return;
+        }
+
+        const size_t K1 = K >> 1;
+        const size_t K2 = K - K1;
+        // op(A) is upper triangular
+        const bool opUpper = (Uplo == FflasUpper) == (TransA == FflasNoTrans);
+        typename Field::ConstElement_ptr A3 = A + K1*(lda+1);
+        typename Field::ConstElement_ptr A2 = (Uplo == FflasUpper) ? A + K1 : A + K1*lda;
+        ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> MMParH (nt);
+
+        if (Side == FflasLeft){
+            typename Field::Element_ptr B1 = B;
+            typename Field::Element_ptr B2 = B + K1*ldb;
+            if (opUpper){
+                // B1 <- alpha (A1 B1 + A2 B2), B2 <- alpha A3 B2
+                ftrmm (F, Side, Uplo, TransA, Diag, K1, N, alpha, A, lda, B1, ldb, H);
+                fgemm (F, TransA, FflasNoTrans, K1, N, K2, alpha, A2, lda, B2, ldb, F.one, B1, ldb, MMParH);
+                ftrmm (F, Side, Uplo, TransA, Diag, K2, N, alpha, A3, lda, B2, ldb, H);
+            } else {
+                // B2 <- alpha (A2 B1 + A3 B2), B1 <- alpha A1 B1
+                ftrmm (F, Side, Uplo, TransA, Diag, K2, N, alpha, A3, lda, B2, ldb, H);
+                fgemm (F, TransA, FflasNoTrans, K2, N, K1, alpha, A2, lda, B1, ldb, F.one, B2, ldb, MMParH);
+                ftrmm (F, Side, Uplo, TransA, Diag, K1, N, alpha, A, lda, B1, ldb, H);
+            }
+        } else {
+            typename Field::Element_ptr B1 = B;
+            typename Field::Element_ptr B2 = B + K1;
+            if (opUpper){
+                // B2 <- alpha (B1 A2 + B2 A3), B1 <- alpha B1 A1
+                ftrmm (F, Side, Uplo, TransA, Diag, M, K2, alpha, A3, lda, B2, ldb, H);
+                fgemm (F, FflasNoTrans, TransA, M, K2, K1, alpha, B1, ldb, A2, lda, F.one, B2, ldb, MMParH);
+                ftrmm (F, Side, Uplo, TransA, Diag, M, K1, alpha, A, lda, B1, ldb, H);
+            } else {
+                // B1 <- alpha (B1 A1 + B2 A2), B2 <- alpha B2 A3
+                ftrmm (F, Side, Uplo, TransA, Diag, M, K1, alpha, A, lda, B1, ldb, H);
+                fgemm (F, FflasNoTrans, TransA, M, K1, K2, alpha, B2, ldb, A2, lda, F.one, B1, ldb, MMParH);
+                ftrmm (F, Side, Uplo, TransA, Diag, M, K2, alpha, A3, lda, B2, ldb, H);
+            }
+        }
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_pftrmm_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -840,6 +840,8 @@ namespace FFLAS {
     template <class Field, class SM>
     inline void fspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, const typename Field::Element &beta,
                       typename Field::Element_ptr y) {
+        FFLASFFPACK_INSTRUMENT(fspmv, 2.*double(A.nElements),
+                               double(A.nElements)*(sizeof(typename Field::Element)+sizeof(index_t))+sizeof(typename Field::Element)*double(A.m+A.n));
         sparse_details::init_y(F, A.m, beta, y);
         sparse_details::fspmv_dispatch(F, A, x, y, typename FieldTraits<Field>::category(),
                                        typename isZOSparseMatrix<Field, SM>::type());
@@ -848,6 +850,8 @@ namespace FFLAS {
     template <class Field, class SM>
     inline void fspmm(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
                       const typename Field::Element &beta, typename Field::Element_ptr y, int ldy) {
+        FFLASFFPACK_INSTRUMENT(fspmv, 2.*double(A.nElements)*double(blockSize),
+                               double(A.nElements)*(sizeof(typename Field::Element)+sizeof(index_t))+sizeof(typename Field::Element)*double(A.m+A.n)*double(blockSize));
         sparse_details::init_y(F, A.m, blockSize, beta, y, ldy);
         sparse_details::fspmm_dispatch<Field, SM>(F, A, blockSize, x, ldx, y, ldy, typename FieldTraits<Field>::category(),
                                                   typename isZOSparseMatrix<Field, SM>::type());
@@ -858,6 +862,8 @@ namespace FFLAS {
     template <class Field, class SM>
     inline void pfspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, const typename Field::Element &beta,
                        typename Field::Element_ptr y) {
+        FFLASFFPACK_INSTRUMENT(fspmv, 2.*double(A.nElements),
+                               double(A.nElements)*(sizeof(typename Field::Element)+sizeof(index_t))+sizeof(typename Field::Element)*double(A.m+A.n));
         sparse_details::init_y(F, A.m, beta, y);
         sparse_details::pfspmv<Field, SM>(F, A, x, y,
                                           typename FieldTraits<Field>::category(),
@@ -867,6 +873,8 @@ namespace FFLAS {
     template <class Field, class SM>
     inline void pfspmm(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
                        const typename Field::Element &beta, typename Field::Element_ptr y, int ldy) {
+        FFLASFFPACK_INSTRUMENT(fspmv, 2.*double(A.nElements)*double(blockSize),
+                               double(A.nElements)*(sizeof(typename Field::Element)+sizeof(index_t))+sizeof(typename Field::Element)*double(A.m+A.n)*double(blockSize));
         sparse_details::init_y(F, A.m, blockSize, beta, y, ldy);
         sparse_details::pfspmm_dispatch<Field, SM>(F, A, blockSize, x, ldx, y, ldy, typename FieldTraits<Field>::category(),
                                                    typename isZOSparseMatrix<Field, SM>::type());
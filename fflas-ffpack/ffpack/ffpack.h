@@ -104,6 +104,11 @@ namespace FFPACK { /* Permutations */
     /*****************/
 
 
+    /** A permutation stored in LAPACK, Math or compressed format, composed lazily
+     * (see ffpack_permutation_type.inl)
+     */
+    class Permutation;
+
     void LAPACKPerm2MathPerm (size_t * MathP, const size_t * LapackP,
                               const size_t N);
 
@@ -272,6 +277,19 @@ namespace FFPACK { /* Permutations */
                      const FFLAS::FFLAS_TRANSPOSE Trans,
                      const size_t M, const size_t ibeg, const size_t iend,
                      typename Field::Element_ptr A, const size_t lda, const size_t * P, const size_t R);
+
+    /** Apply the permutation P, or its inverse if Trans==FflasTrans, to the rows (Side==FflasLeft)
+     * or columns (Side==FflasRight) of the matrix A, with M columns or rows.
+     * Pending compositions of P are applied in a single pass over A.
+     */
+    template<class Field>
+    void applyP (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                 const size_t M, typename Field::Element_ptr A, const size_t lda, const Permutation& P);
+
+    template<class Field, class PSHelper>
+    void applyP (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                 const size_t M, typename Field::Element_ptr A, const size_t lda, const Permutation& P,
+                 const PSHelper& psH);
     /* \cond */
     template<class Field>
     void
@@ -445,11 +463,33 @@ namespace FFPACK { /* ftrtr */
             const size_t N, typename Field::Element_ptr A, const size_t lda,
             const size_t threshold = __FFLASFFPACK_FTRTRI_THRESHOLD);
 
+    /** Compute the inverse of a triangular matrix, sequentially or in parallel.
+     * In parallel, the inversions of the two diagonal blocks run as tasks, each one concurrently
+     * with one of the two products forming the off-diagonal block.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     */
+    template<class Field>
+    void
+    ftrtri (const Field& F, const FFLAS::FFLAS_UPLO Uplo, const FFLAS::FFLAS_DIAG Diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Sequential& psH,
+            const size_t threshold = __FFLASFFPACK_FTRTRI_THRESHOLD);
+
+    template<class Field, class Cut, class Param>
+    void
+    ftrtri (const Field& F, const FFLAS::FFLAS_UPLO Uplo, const FFLAS::FFLAS_DIAG Diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Parallel<Cut,Param>& psH,
+            const size_t threshold = __FFLASFFPACK_FTRTRI_THRESHOLD);
 
     template<class Field>
     void trinv_left( const Field& F, const size_t N, typename Field::ConstElement_ptr L, const size_t ldl,
                      typename Field::Element_ptr X, const size_t ldx );
 
+    template<class Field, class PSHelper>
+    void trinv_left( const Field& F, const size_t N, typename Field::ConstElement_ptr L, const size_t ldl,
+                     typename Field::Element_ptr X, const size_t ldx, const PSHelper& psH);
+
     /**  @brief Compute the product of two triangular matrices of opposite shape.
      * Product UL or LU of the upper, resp lower triangular matrices U and L
      * stored one above the other in the square matrix A.
@@ -466,6 +506,27 @@ namespace FFPACK { /* ftrtr */
     ftrtrm (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_DIAG diag,
             const size_t N,	typename Field::Element_ptr A, const size_t lda);
 
+    /** Compute the product of two triangular matrices of opposite shape, sequentially or in parallel.
+     * In parallel, the product of the off-diagonal blocks runs as a task concurrently with the
+     * recursive call on the first diagonal block.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     * @param threshold the dimension below which the parallel recursion switches to the
+     * sequential ftrtrm
+     */
+    template<class Field>
+    void
+    ftrtrm (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_DIAG diag,
+            const size_t N,	typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Sequential& psH,
+            const size_t threshold = __FFLASFFPACK_FTRTRM_THRESHOLD);
+
+    template<class Field, class Cut, class Param>
+    void
+    ftrtrm (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_DIAG diag,
+            const size_t N,	typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Parallel<Cut,Param>& psH,
+            const size_t threshold = __FFLASFFPACK_FTRTRM_THRESHOLD);
+
     /** @brief Solve a triangular system with a triangular right hand side of the same shape.
      * @param F base field
      * @param Side set to FflasLeft to compute U1^-1*U2 or L1^-1*L2, FflasRight to compute U1*U2^-1 or L1*L2^-1
@@ -485,6 +546,26 @@ namespace FFPACK { /* ftrtr */
             typename Field::ConstElement_ptr A, const size_t lda,
             typename Field::Element_ptr B, const size_t ldb, const size_t threshold=__FFLASFFPACK_FTRSTR_THRESHOLD);
 
+    /** @brief Solve a triangular system with a triangular right hand side, sequentially or in parallel.
+     * In parallel, the two recursive calls on the diagonal blocks run as tasks.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     */
+    template<class Field>
+    void
+    ftrstr (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_UPLO Uplo,
+            const FFLAS::FFLAS_DIAG diagA, const FFLAS::FFLAS_DIAG diagB, const size_t N,
+            typename Field::ConstElement_ptr A, const size_t lda,
+            typename Field::Element_ptr B, const size_t ldb,
+            const FFLAS::ParSeqHelper::Sequential& psH, const size_t threshold=__FFLASFFPACK_FTRSTR_THRESHOLD);
+
+    template<class Field, class Cut, class Param>
+    void
+    ftrstr (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_UPLO Uplo,
+            const FFLAS::FFLAS_DIAG diagA, const FFLAS::FFLAS_DIAG diagB, const size_t N,
+            typename Field::ConstElement_ptr A, const size_t lda,
+            typename Field::Element_ptr B, const size_t ldb,
+            const FFLAS::ParSeqHelper::Parallel<Cut,Param>& psH, const size_t threshold=__FFLASFFPACK_FTRSTR_THRESHOLD);
+
     /** @brief Solve a triangular system in a symmetric sum: find B upper/lower triangular such that A^T B + B^T A = C
      * where C is symmetric. C is overwritten by B.
      * @param F base field
@@ -611,9 +692,103 @@ namespace FFPACK {
                  typename Field::Element_ptr A, const size_t lda,
                  size_t*P, size_t *Q, const FFLAS::ParSeqHelper::Parallel<Cut,Param>& PSHelper);
 
+    /** Same as above, with P and Q returned as Permutation objects of size M and N.
+     */
+    template<class Field>
+    size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
+                 const size_t M, const size_t N,
+                 typename Field::Element_ptr A, const size_t lda,
+                 Permutation& P, Permutation& Q);
+
+    template<class Field, class PSHelper>
+    size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
+                 const size_t M, const size_t N,
+                 typename Field::Element_ptr A, const size_t lda,
+                 Permutation& P, Permutation& Q, const PSHelper& psH);
+
 } // FFPACK PLUQ
 // #include "ffpack_pluq.inl"
 
+#ifdef __FFLASFFPACK_HAVE_SYS_MMAN_H
+
+namespace FFPACK { /* out-of-core PLUQ */
+
+    /** @brief An M x N matrix stored in a file, by column panels of panelWidth columns.
+     * Each panel is stored row major, with leading dimension panelCols(k), and is memory mapped
+     * on demand: load maps a panel, evict writes it back and releases its pages, and prefetch
+     * reads a panel from the file in a background thread while the caller works on another one.
+     * An existing file is reused as is, so that a matrix can be factored in several sessions.
+     * The elements must be trivially copyable. The class is defined in ffpack_pluq_ooc.inl.
+     */
+    template <class Field>
+    class TileStore;
+
+    /** @brief Out-of-core PLUQ factorization of the matrix stored in \p A.
+     * Left looking algorithm over the column panels of A: each panel is updated by the pivots
+     * of the previous ones (\c ftrsm and \c fgemm), then its Schur complement rows are factored
+     * in core by \c PLUQ. Only the current panel, the previous one being read and the next one
+     * being prefetched are held in memory.
+     * On output, A holds the compact storage L\U of the factors, with its columns in the original order:
+     * applying \p Q to its columns, with applyP (F, FflasRight, FflasTrans, ...), gives the
+     * compact storage of the in-core \c PLUQ. P and Q use LAPACK's convention.
+     * @param F base field
+     * @param Diag whether U should have a unit diagonal (FflasUnit) or not (FflasNoUnit)
+     * @param A the matrix, overwritten by its factors
+     * @param P the row permutation, of size A.rowdim()
+     * @param Q the column permutation, of size A.coldim()
+     * @param psH a ParSeqHelper for the in-core kernels
+     * @return the rank of \p A
+     */
+    template <class Field, class PSHelper>
+    size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag, TileStore<Field>& A,
+                 size_t * P, size_t * Q, const PSHelper& psH);
+
+    template <class Field>
+    size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag, TileStore<Field>& A,
+                 size_t * P, size_t * Q);
+
+    /** Rank of the matrix stored in \p A, which is overwritten by its PLUQ factors.
+     */
+    template <class Field>
+    size_t Rank (const Field& F, TileStore<Field>& A);
+
+} // FFPACK out-of-core PLUQ
+// #include "ffpack_pluq_ooc.inl"
+#endif
+
+namespace FFPACK { /* GF(2) */
+
+    /** PLUQ decomposition over GF(2) of the bit packed matrix \p A, with the conventions of PLUQ:
+     * A is overwritten by L\U, P and Q are in LAPACK format, of size A.rowdim() and A.coldim(), and
+     * the rank profile matrix of A is revealed. The diagonals of L and U being one, the storage is
+     * the same for FflasUnit and FflasNonUnit.
+     * The rows are eliminated in increasing order, the remaining rows being reduced by groups of 64
+     * pivot rows, with 8 tables of the combinations of 8 of them, as in the M4RI method of the Four
+     * Russians.
+     * PLUQ over a field of cardinality 2 switches to this routine from the dimension
+     * __FFLASFFPACK_GF2_THRESHOLD.
+     * @return the rank of \p A
+     */
+    inline size_t PLUQ (FFLAS::GF2Matrix& A, size_t * P, size_t * Q);
+
+    /** Rank of the bit packed matrix \p A, which is overwritten by its reduced rows.
+     */
+    inline size_t Rank (FFLAS::GF2Matrix& A);
+
+    /** \p A is overwritten by its row echelon form over GF(2): its R first rows have their
+     * leading ones at the increasing columns of the column rank profile, written in \p colProfile
+     * if not null, and the other rows are zero.
+     * @return the rank R of \p A
+     */
+    inline size_t RowEchelonForm (FFLAS::GF2Matrix& A, size_t * colProfile = nullptr);
+
+    /** Same as above, the columns of the leading ones being moreover zero outside of their row.
+     */
+    inline size_t ReducedRowEchelonForm (FFLAS::GF2Matrix& A, size_t * colProfile = nullptr);
+
+} // FFPACK GF(2)
+// #include "ffpack_gf2.inl"
+
 namespace FFPACK { /* ludivine */
 
     /** @brief Compute the CUP or PLE factorization of the given matrix.
@@ -797,6 +972,22 @@ namespace FFPACK { /* echelon */
                            size_t* P, size_t* Qt, const bool transform,
                            const FFPACK_LU_TAG LuTag, const PSHelper& psH);
 
+    /** Same as above, with P and Qt returned as Permutation objects of size M and N.
+     */
+    template <class Field>
+    size_t
+    RowEchelonForm (const Field& F, const size_t M, const size_t N,
+                    typename Field::Element_ptr A, const size_t lda,
+                    Permutation& P, Permutation& Qt, const bool transform=false,
+                    const FFPACK_LU_TAG LuTag=FfpackSlabRecursive);
+
+    template <class Field, class PSHelper>
+    size_t
+    RowEchelonForm (const Field& F, const size_t M, const size_t N,
+                    typename Field::Element_ptr A, const size_t lda,
+                    Permutation& P, Permutation& Qt, const bool transform,
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
 
     /** Compute the Reduced Column Echelon form of the input matrix in-place.
      *
@@ -926,6 +1117,25 @@ namespace FFPACK { /* invert */
             typename Field::Element_ptr A, const size_t lda,
             int& nullity);
 
+    template <class Field>
+    typename Field::Element_ptr
+    pInvert (const Field& F, const size_t M,
+             typename Field::Element_ptr A, const size_t lda,
+             int& nullity, size_t numthreads = 0);
+
+    /**  @brief Invert the given matrix in place, sequentially or in parallel,
+     * or computes its nullity if it is singular.
+     *
+     * In parallel, the reduced row echelon form and its transform are computed by the
+     * tile recursive PLUQ followed by the parallel ftrtri and ftrtrm.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     */
+    template <class Field, class PSHelper>
+    typename Field::Element_ptr
+    Invert (const Field& F, const size_t M,
+            typename Field::Element_ptr A, const size_t lda,
+            int& nullity, const PSHelper& psH);
+
     /** @brief Invert the given matrix
      * or computes its nullity if it is singular.
      *
@@ -1089,7 +1299,22 @@ namespace FFPACK { /* charpoly */
                              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
                              size_t& Nb, typename PolRing::Domain_t::Element_ptr& B, size_t& ldb,
                              typename PolRing::Domain_t::RandIter& g, const size_t degree=__FFLASFFPACK_ARITHPROG_THRESHOLD);
-        
+
+        /** Kind of the field F in the decision table of FfpackAuto:
+         * 1 for float, 2 for double, 3 for int64_t elements, 4 otherwise.
+         */
+        template <class Field>
+        inline size_t CharPolyFieldKind (const Field& F);
+
+        /** Variant used by CharPoly with FfpackAuto for a matrix of order N over F.
+         * The first matching entry of the decision table __FFLASFFPACK_CHARPOLY_AUTO_TABLE
+         * (see autotune/charpoly-auto.C) is used. Otherwise Danilevski is used below \p degree,
+         * the threshold of CharPoly, then LUKrylov below __FFLASFFPACK_CHARPOLY_LUKrylov_ArithProg_THRESHOLD,
+         * then ArithProg.
+         */
+        template <class Field>
+        inline FFPACK_CHARPOLY_TAG CharPolyAutoVariant (const Field& F, const size_t N, const size_t degree);
+
         template <class PolRing>
         inline std::list<typename PolRing::Element>&
         ArithProg (const PolRing& PR, std::list<typename PolRing::Element>& frobeniusForm,
@@ -1190,6 +1415,195 @@ namespace FFPACK { /* minpoly */
 } // FFPACK minpoly
 // #include "ffpack_minpoly.inl"
 
+#ifndef __FFLASFFPACK_WIEDEMANN_EARLY_TERM
+#define __FFLASFFPACK_WIEDEMANN_EARLY_TERM 20
+#endif
+#ifndef __FFLASFFPACK_WIEDEMANN_MAX_TRIALS
+#define __FFLASFFPACK_WIEDEMANN_MAX_TRIALS 4
+#endif
+
+namespace FFPACK { /* Wiedemann: black box sparse routines */
+
+    /**
+     * @brief Compute the minimal polynomial of the sparse matrix A, used as a black box.
+     * The algorithm is Wiedemann's with early termination, with \p nbProj scalar projections:
+     * the sequences \f$ u_j^TA^iv_j\f$ are generated together using fspmm (pfspmm in parallel),
+     * a scalar Berlekamp-Massey step computes the generator of each of them and their lcm is returned.
+     * This is not block Wiedemann: the number of black box applications is the one of a single
+     * projection, about twice the degree of the minimal polynomial, whatever \p nbProj.
+     * It is Monte Carlo: the result is a factor of the minimal polynomial,
+     * equal to it with high probability when the field is large or \p nbProj is larger than one.
+     * @param F the base field
+     * @param [out] minP the minimal polynomial of \p A
+     * @param A a square sparse matrix in any \c FFLAS::Sparse format, std::invalid_argument is thrown otherwise
+     * @param G a random iterator
+     * @param nbProj number of scalar projections, generated together
+     * @param psH (optional) a ParSeqHelper to choose between sequential and parallel black box applications
+     */
+    template <class Field, class SM, class Polynomial, class RandIter, class PSHelper>
+    Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, RandIter& G,
+                   const size_t nbProj, const PSHelper& psH);
+
+    template <class Field, class SM, class Polynomial, class RandIter>
+    Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, RandIter& G,
+                   const size_t nbProj = 1);
+
+    template <class Field, class SM, class Polynomial>
+    Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, const size_t nbProj = 1);
+
+    /**
+     * @brief Compute the rank of the m x n sparse matrix A, used as a black box.
+     * The minimal polynomial of the preconditioned symmetric matrix \f$ D_1A^TD_2AD_1\f$,
+     * with \f$ D_1, D_2\f$ random non-singular diagonal matrices, is computed as in SparseMinPoly.
+     * When m < n, the m x m matrix \f$ D_1AD_2A^TD_1\f$ is used instead.
+     * Its degree, minus its valuation, is the rank of \p A with high probability.
+     * The transpose of A must be given as a second black box, in any \c FFLAS::Sparse format.
+     * @param F the base field
+     * @param A an m x n sparse matrix
+     * @param At the n x m transpose of \p A, std::invalid_argument is thrown if its dimensions do not match
+     * @param G a random iterator
+     * @param nbProj number of scalar projections, generated together
+     * @param psH (optional) a ParSeqHelper to choose between sequential and parallel black box applications
+     * @warning over small fields, the probability of success is low: use an extension field.
+     */
+    template <class Field, class SM, class SMT, class RandIter, class PSHelper>
+    size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, RandIter& G,
+                const size_t nbProj, const PSHelper& psH);
+
+    template <class Field, class SM, class SMT, class RandIter>
+    size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, RandIter& G, const size_t nbProj = 1);
+
+    template <class Field, class SM, class SMT>
+    size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, const size_t nbProj = 1);
+
+    /**
+     * @brief Compute the determinant of the square sparse matrix A, used as a black box.
+     * The minimal polynomial of \f$ AD\f$, for a random non-singular diagonal matrix \f$ D\f$, is
+     * its characteristic polynomial with high probability, from which the determinant is read.
+     * A singular matrix is detected with certainty when the projected minimal polynomial vanishes at 0.
+     * A non square matrix is reported singular, with \p det set to zero, without any black box application.
+     * @param F the base field
+     * @param [out] det the determinant of \p A
+     * @param A a square sparse matrix in any \c FFLAS::Sparse format
+     * @param G a random iterator
+     * @param nbProj number of scalar projections, generated together
+     * @param psH a ParSeqHelper to choose between sequential and parallel black box applications
+     * @param maxTrials number of preconditioners to try before throwing CharpolyFailed
+     */
+    template <class Field, class SM, class RandIter, class PSHelper>
+    typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, RandIter& G,
+               const size_t nbProj, const PSHelper& psH,
+               const size_t maxTrials = __FFLASFFPACK_WIEDEMANN_MAX_TRIALS);
+
+    template <class Field, class SM, class RandIter>
+    typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, RandIter& G,
+               const size_t nbProj = 1);
+
+    template <class Field, class SM>
+    typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, const size_t nbProj = 1);
+
+} // FFPACK Wiedemann
+// #include "ffpack_wiedemann.inl"
+
+#ifndef __FFLASFFPACK_SPARSE_ELIM_DENSITY_THRESHOLD
+#define __FFLASFFPACK_SPARSE_ELIM_DENSITY_THRESHOLD 0.1
+#endif
+#ifndef __FFLASFFPACK_SPARSE_ELIM_MARKOWITZ_SEARCH
+#define __FFLASFFPACK_SPARSE_ELIM_MARKOWITZ_SEARCH 4
+#endif
+
+namespace FFPACK { /* Sparse elimination */
+
+    /** @brief Factors of a sparse-dense hybrid elimination of an m x n matrix A.
+     *
+     * The first \c L.size() pivots are eliminated in sparse form: at step k, the pivot
+     * is \f$ A_{r_k,c_k}\f$ with \f$ r_k =\f$ \c pivotRows[k], \f$ c_k =\f$ \c pivotCols[k];
+     * \c U[k] stores the row \f$ r_k\f$ at that step (including the pivot) and
+     * \c L[k] the pairs (i, multiplier) of the row operations \f$ row_i \gets row_i - \ell_{i} row_{r_k}\f$.
+     * The remaining Schur complement, restricted to its non zero rows \c denseRows and non zero
+     * columns \c denseCols, is stored densely in \c S and factored in place by \c PLUQ.
+     * The rows of \c zeroRows were reduced to zero by the sparse phase.
+     *
+     * \c pivotRows and \c pivotCols list the \c rank pivots of both phases: they index a non singular
+     * \c rank x \c rank submatrix of A, but are not its lexicographically minimal rank profiles.
+     */
+    template <class Field>
+    struct SparsePLUQFactors {
+        typedef typename Field::Element Element;
+        typedef std::vector<std::pair<size_t, Element> > SparseVect;
+
+        size_t rowdim = 0, coldim = 0, rank = 0;
+        std::vector<size_t> pivotRows, pivotCols;
+        std::vector<SparseVect> L, U;
+        std::vector<size_t> zeroRows;
+        std::vector<size_t> denseRows, denseCols;
+        typename Field::Element_ptr S = nullptr;
+        size_t * P = nullptr;
+        size_t * Q = nullptr;
+        size_t denseRank = 0;
+
+        SparsePLUQFactors () {}
+        SparsePLUQFactors (const SparsePLUQFactors&) = delete;
+        SparsePLUQFactors& operator= (const SparsePLUQFactors&) = delete;
+        ~SparsePLUQFactors () { FFLAS::fflas_delete (S, P, Q); }
+    };
+
+    /** @brief Sparse-dense hybrid PLUQ elimination of a CSR matrix.
+     * Pivots are chosen by a Markowitz criterion (minimal \f$(r_i-1)(c_j-1)\f$ among the entries
+     * of the \c __FFLASFFPACK_SPARSE_ELIM_MARKOWITZ_SEARCH sparsest active rows) and eliminated in
+     * sparse form, until the density of the active Schur complement exceeds \p densityThreshold.
+     * The remainder is then handed to \c PLUQ, sequential or parallel according to \p psH.
+     * @param F base field
+     * @param A the input matrix, left unchanged
+     * @param [out] LU the factors of the elimination
+     * @param psH a ParSeqHelper for the dense PLUQ of the Schur complement
+     * @param densityThreshold ratio of non zero entries of the Schur complement triggering the dense phase
+     * @return the rank of \p A
+     */
+    template <class Field, class PSHelper>
+    size_t
+    SparsePLUQ (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A,
+                SparsePLUQFactors<Field>& LU, const PSHelper& psH,
+                const double densityThreshold = __FFLASFFPACK_SPARSE_ELIM_DENSITY_THRESHOLD);
+
+    template <class Field>
+    size_t
+    SparsePLUQ (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A,
+                SparsePLUQFactors<Field>& LU);
+
+    /** @brief Rank of a CSR matrix, by sparse-dense hybrid elimination.
+     * Deterministic, unlike the black box \c SparseRank, which is Monte Carlo but does not fill in.
+     */
+    template <class Field>
+    size_t
+    SparseEliminationRank (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A);
+
+    /** @brief Solve \f$ Ax=b\f$ from the factors computed by \c SparsePLUQ.
+     * If the system is rank deficient, a solution is returned when it is consistent:
+     * the non pivot unknowns are set to zero.
+     * @param F base field
+     * @param LU the factors of A
+     * @param [out] x a solution vector of size \c LU.coldim
+     * @param b the right hand side, of size \c LU.rowdim
+     * @return false if the system is inconsistent
+     */
+    template <class Field>
+    bool
+    SparseSolve (const Field& F, const SparsePLUQFactors<Field>& LU,
+                 typename Field::Element_ptr x, typename Field::ConstElement_ptr b);
+
+} // FFPACK Sparse elimination
+// #include "ffpack_sparseelim.inl"
+
 namespace FFPACK { /* Krylov Elim */
 
     /* \cond */
@@ -1622,6 +2036,25 @@ namespace FFPACK { /* Solutions */
                    typename Field::Element_ptr T, const size_t ldt,
                    const bool OnlyNonZeroVectors = false);
 
+    /// Same as above, splitting the rows of T in parallel tasks if psH is a Parallel helper
+    template <class Field>
+    void
+    getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                   const FFLAS::FFLAS_DIAG diag,
+                   const size_t M, const size_t N, const size_t R,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const bool OnlyNonZeroVectors, const FFLAS::ParSeqHelper::Sequential psH);
+
+    template <class Field, class Cut, class Param>
+    void
+    getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                   const FFLAS::FFLAS_DIAG diag,
+                   const size_t M, const size_t N, const size_t R,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const bool OnlyNonZeroVectors, const FFLAS::ParSeqHelper::Parallel<Cut,Param> psH);
+
     /** Cleans up a compact storage A=L\U to reveal a triangular matrix of rank R.
      * @param F: base field
      * @param UpLo: selects if the upper (FflasUpper) or lower (FflasLower) triangular matrix is revealed
@@ -1668,6 +2101,17 @@ namespace FFPACK { /* Solutions */
                     const bool OnlyNonZeroVectors = false,
                     const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
 
+    /// Same as above, with the copies and permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                    const FFLAS::FFLAS_DIAG diag,
+                    const size_t M, const size_t N, const size_t R, const size_t* P,
+                    typename Field::ConstElement_ptr A, const size_t lda,
+                    typename Field::Element_ptr T, const size_t ldt,
+                    const bool OnlyNonZeroVectors,
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
     /** Cleans up a compact storage A=L\U obtained by RowEchelonForm or ColumnEchelonForm
      * to reveal an echelon form of rank R.
      * Either L or U is in Echelon form (depending on Uplo)
@@ -1691,6 +2135,15 @@ namespace FFPACK { /* Solutions */
                     typename Field::Element_ptr A, const size_t lda,
                     const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
 
+    /// Same as above, with the permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                    const FFLAS::FFLAS_DIAG diag,
+                    const size_t M, const size_t N, const size_t R, const size_t* P,
+                    typename Field::Element_ptr A, const size_t lda,
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
     /** Extracts a transformation matrix to echelon form from a compact storage A=L\U
      * of rank R obtained by RowEchelonForm or ColumnEchelonForm.
      * If Uplo == FflasLower:
@@ -1720,6 +2173,27 @@ namespace FFPACK { /* Solutions */
                          typename Field::ConstElement_ptr A, const size_t lda,
                          typename Field::Element_ptr T, const size_t ldt,
                          const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
+
+    /// Same as above, with the copies and permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                         const FFLAS::FFLAS_DIAG diag,
+                         const size_t M, const size_t N, const size_t R, const size_t* P, const size_t* Q,
+                         typename Field::ConstElement_ptr A, const size_t lda,
+                         typename Field::Element_ptr T, const size_t ldt,
+                         const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
+    /// Same as above, with P and Q given as Permutation objects
+    template <class Field>
+    void
+    getEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                         const FFLAS::FFLAS_DIAG diag,
+                         const size_t M, const size_t N, const size_t R,
+                         const Permutation& P, const Permutation& Q,
+                         typename Field::ConstElement_ptr A, const size_t lda,
+                         typename Field::Element_ptr T, const size_t ldt,
+                         const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
     /** Extracts a matrix in echelon form from a compact storage A=L\U of rank R obtained by
      * ReducedRowEchelonForm or ReducedColumnEchelonForm with transform = true.
      * Either L or U is in Echelon form (depending on Uplo)
@@ -1747,6 +2221,16 @@ namespace FFPACK { /* Solutions */
                            const bool OnlyNonZeroVectors = false,
                            const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
 
+    /// Same as above, with the copies and permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                           const size_t M, const size_t N, const size_t R, const size_t* P,
+                           typename Field::ConstElement_ptr A, const size_t lda,
+                           typename Field::Element_ptr T, const size_t ldt,
+                           const bool OnlyNonZeroVectors,
+                           const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
     /** Cleans up a compact storage A=L\U of rank R obtained by ReducedRowEchelonForm or
      * ReducedColumnEchelonForm with transform = true.
      * Either L or U is in Echelon form (depending on Uplo)
@@ -1769,6 +2253,14 @@ namespace FFPACK { /* Solutions */
                            typename Field::Element_ptr A, const size_t lda,
                            const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
 
+    /// Same as above, with the initializations and permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                           const size_t M, const size_t N, const size_t R, const size_t* P,
+                           typename Field::Element_ptr A, const size_t lda,
+                           const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
     /** Extracts a transformation matrix to echelon form from a compact storage A=L\U
      * of rank R obtained by RowEchelonForm or ColumnEchelonForm.
      * If Uplo == FflasLower:
@@ -1797,6 +2289,25 @@ namespace FFPACK { /* Solutions */
                                 typename Field::ConstElement_ptr A, const size_t lda,
                                 typename Field::Element_ptr T, const size_t ldt,
                                 const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
+
+    /// Same as above, with the copies and permutations run in parallel if psH is a Parallel helper
+    template <class Field, class PSHelper>
+    void
+    getReducedEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                                const size_t M, const size_t N, const size_t R, const size_t* P, const size_t* Q,
+                                typename Field::ConstElement_ptr A, const size_t lda,
+                                typename Field::Element_ptr T, const size_t ldt,
+                                const FFPACK_LU_TAG LuTag, const PSHelper& psH);
+
+    /// Same as above, with P and Q given as Permutation objects
+    template <class Field>
+    void
+    getReducedEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                                const size_t M, const size_t N, const size_t R,
+                                const Permutation& P, const Permutation& Q,
+                                typename Field::ConstElement_ptr A, const size_t lda,
+                                typename Field::Element_ptr T, const size_t ldt,
+                                const FFPACK_LU_TAG LuTag = FfpackSlabRecursive);
     /** Auxiliary routine: determines the permutation that changes a PLUQ decomposition
      * into a echelon form revealing PLUQ decomposition
      */
@@ -1829,6 +2340,14 @@ namespace FFPACK { /* not used */
                                   const size_t* QtPointer,
                                   typename Field::Element_ptr X, const size_t ldx);
 
+    template <class Field, class PSHelper>
+    typename Field::Element_ptr
+    LQUPtoInverseOfFullRankMinor( const Field& F, const size_t rank,
+                                  typename Field::Element_ptr A_factors, const size_t lda,
+                                  const size_t* QtPointer,
+                                  typename Field::Element_ptr X, const size_t ldx,
+                                  const PSHelper& psH);
+
 } // FFPACK
 // include precompiled instantiation headers (avoiding to recompile them)
 #ifdef FFPACK_COMPILED
@@ -1846,9 +2365,11 @@ namespace FFPACK { /* not used */
 // Checkers
 #include "fflas-ffpack/checkers/checkers_ffpack.inl"
 //---------------------------------------------------------------------
+#include "ffpack_gf2.inl"
 #include "ffpack_pluq.inl"
 #include "ffpack_pluq_mp.inl"
 #include "ffpack_ppluq.inl"
+#include "ffpack_pluq_ooc.inl"
 #include "ffpack_ludivine.inl"
 #include "ffpack_ludivine_mp.inl"
 #include "ffpack_echelonforms.inl"
@@ -1864,8 +2385,11 @@ namespace FFPACK { /* not used */
 #include "ffpack_charpoly.inl"
 #include "ffpack_frobenius.inl"
 #include "ffpack_minpoly.inl"
+#include "ffpack_wiedemann.inl"
+#include "ffpack_sparseelim.inl"
 #include "ffpack_krylovelim.inl"
 #include "ffpack_permutation.inl"
+#include "ffpack_permutation_type.inl"
 #include "ffpack_rankprofiles.inl"
 #include "ffpack_det_mp.inl"
 #include "ffpack.inl"
@@ -60,6 +60,8 @@ namespace FFPACK {
     {
         if (M == 0 and  N  == 0)
             return 0 ;
+        if (FFLAS::Protected::useGF2 (F, std::min (M,N)))
+            return Protected::Rank_gf2 (F, M, N, A, lda);
 
         size_t *P = FFLAS::fflas_new<size_t>(M);
         size_t *Q = FFLAS::fflas_new<size_t>(N);
@@ -166,6 +168,7 @@ namespace FFPACK {
            typename Field::Element_ptr x, const int incx,
            typename Field::ConstElement_ptr b, const int incb, PSHelper& psH)
     {
+        Checker_fgesv<Field> checker (F, FFLAS::FflasLeft, M, M, 1, A, lda, b, (size_t) incb);
 
         size_t *P = FFLAS::fflas_new<size_t>(M);
         size_t *rowP = FFLAS::fflas_new<size_t>(M);
@@ -187,6 +190,8 @@ namespace FFPACK {
             FFLAS::fflas_delete( rowP);
             FFLAS::fflas_delete( P);
 
+            checker.check (x, (size_t) incx, 0);
+
             return x;
 
         }
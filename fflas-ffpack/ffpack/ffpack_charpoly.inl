@@ -64,14 +64,8 @@ namespace FFPACK {
         const Field& F = R.getdomain();
 
         FFPACK_CHARPOLY_TAG tag = CharpTag;
-        if (tag == FfpackAuto){
-            if (N < degree)
-                tag = FfpackDanilevski;
-            else if (N < degree)
-                tag = FfpackLUK;
-            else
-                tag = FfpackArithProgKrylovPrecond;
-        }
+        if (tag == FfpackAuto)
+            tag = Protected::CharPolyAutoVariant (F, N, degree);
         switch (tag){
             case FfpackDanilevski: return Danilevski (F, charp, N, A, lda);
             case FfpackLUK:
@@ -180,6 +174,34 @@ namespace FFPACK {
 
 
     namespace Protected {
+        template <class Field>
+        inline size_t CharPolyFieldKind (const Field& F)
+        {
+            typedef typename Field::Element Element;
+            if (std::is_same<Element,float>::value) return 1;
+            if (std::is_same<Element,double>::value) return 2;
+            if (std::is_same<Element,int64_t>::value) return 3;
+            return 4;
+        }
+
+        template <class Field>
+        inline FFPACK_CHARPOLY_TAG CharPolyAutoVariant (const Field& F, const size_t N, const size_t degree)
+        {
+            // entries {field kind, max bitsize of p, max N, variant}, 0 meaning any
+            static const size_t table[][4] = __FFLASFFPACK_CHARPOLY_AUTO_TABLE;
+            const size_t kind = CharPolyFieldKind (F);
+            const size_t bits = Givaro::Integer (F.characteristic()).bitsize();
+            for (auto& e : table)
+                if ((!e[0] || e[0] == kind) && (!e[1] || bits <= e[1]) && (!e[2] || N <= e[2])
+                    && e[3] != FfpackAuto)
+                    return FFPACK_CHARPOLY_TAG (e[3]);
+            if (N < degree)
+                return FfpackDanilevski;
+            if (N < __FFLASFFPACK_CHARPOLY_LUKrylov_ArithProg_THRESHOLD)
+                return FfpackLUK;
+            return FfpackArithProgKrylovPrecond;
+        }
+
         template <class Field, class Polynomial, class RandIter>
         std::list<Polynomial>&
         LUKrylov (const Field& F, std::list<Polynomial>& charp, const size_t N,
@@ -72,8 +72,8 @@ inline size_t FFPACK::ColumnEchelonForm (const Field& F, const size_t M, const s
         }
 
     if (transform){
-        ftrtri (F, FFLAS::FflasUpper, FFLAS::FflasNonUnit, r, A, lda);
-        ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, N-r, F.mOne, A, lda, A+r, lda);
+        ftrtri (F, FFLAS::FflasUpper, FFLAS::FflasNonUnit, r, A, lda, psH);
+        ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, r, N-r, F.mOne, A, lda, A+r, lda, psH);
     }
 
     return r;
@@ -104,24 +104,38 @@ inline size_t FFPACK::pRowEchelonForm (const Field& F, const size_t M, const siz
     return r;
 }
 
+namespace FFPACK {
+    /// RowEchelonForm without its checker, for the routines that check their own result
+    template <class Field, class PSHelper>
+    inline size_t _RowEchelonForm (const Field& F, const size_t M, const size_t N,
+                                   typename Field::Element_ptr A, const size_t lda,
+                                   size_t* P, size_t* Qt, const bool transform,
+                                   const FFPACK_LU_TAG LuTag, const PSHelper& psH)
+    {
+        size_t r;
+        if (LuTag == FFPACK::FfpackSlabRecursive)
+            r = LUdivine (F, FFLAS::FflasNonUnit, FFLAS::FflasTrans, M, N, A, lda, P, Qt);
+        else{
+            r = PLUQ (F, FFLAS::FflasUnit, M, N, A, lda, P, Qt, psH);
+        }
+
+        if (transform){
+            ftrtri (F, FFLAS::FflasLower, FFLAS::FflasNonUnit, r, A, lda, psH);
+            ftrmm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, M-r, r, F.mOne, A, lda, A+r*lda, lda, psH);
+        }
+        return r;
+    }
+} // FFPACK
+
 template <class Field, class PSHelper>
 inline size_t FFPACK::RowEchelonForm (const Field& F, const size_t M, const size_t N,
                                          typename Field::Element_ptr A, const size_t lda,
                                          size_t* P, size_t* Qt, const bool transform,
                                          const FFPACK_LU_TAG LuTag, const PSHelper& psH)
 {
-    size_t r;
-    if (LuTag == FFPACK::FfpackSlabRecursive)
-        r = LUdivine (F, FFLAS::FflasNonUnit, FFLAS::FflasTrans, M, N, A, lda, P, Qt);
-    else{
-        r = PLUQ (F, FFLAS::FflasUnit, M, N, A, lda, P, Qt, psH);
-        }
-
-    if (transform){
-        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasNonUnit, r, A, lda);
-        ftrmm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, M-r, r, F.mOne, A, lda, A+r*lda, lda);
-    }
-
+    FFPACK::Checker_echelon<Field> checker (F, M, N, A, lda);
+    size_t r = FFPACK::_RowEchelonForm (F, M, N, A, lda, P, Qt, transform, LuTag, psH);
+    checker.check (A, lda, r, P, Qt, transform, LuTag);
     return r;
 }
 
@@ -173,11 +187,11 @@ FFPACK::ReducedColumnEchelonForm (const Field& F, const size_t M, const size_t N
         }
     }
     if (transform){
-        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasUnit, r, A, lda);
-        ftrmm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, M-r, r, F.one, A, lda, A+r*lda, lda);
-        ftrtrm (F, FFLAS::FflasLeft, FFLAS::FflasNonUnit, r, A, lda);
+        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasUnit, r, A, lda, psH);
+        ftrmm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, M-r, r, F.one, A, lda, A+r*lda, lda, psH);
+        ftrtrm (F, FFLAS::FflasLeft, FFLAS::FflasNonUnit, r, A, lda, psH);
     } else {
-        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, M-r, r, F.one, A, lda, A+r*lda, lda);
+        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, M-r, r, F.one, A, lda, A+r*lda, lda, psH);
         //FFLAS::fidentity (F, r, r, A, lda);
         //applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, r, 0,(int) r, A, lda, Qt);
     }
@@ -212,6 +226,40 @@ FFPACK::pReducedRowEchelonForm (const Field& F, const size_t M, const size_t N,
     return r;
 }
 
+namespace FFPACK {
+    /// ReducedRowEchelonForm without its checker, also run on the base cases of GaussJordan
+    template <class Field, class PSHelper>
+    inline size_t _ReducedRowEchelonForm (const Field& F, const size_t M, const size_t N,
+                                          typename Field::Element_ptr A, const size_t lda,
+                                          size_t* P, size_t* Qt, const bool transform,
+                                          const FFPACK_LU_TAG LuTag, const PSHelper& psH)
+    {
+        for (size_t i=0; i<N; i++) Qt[i] = i;
+        for (size_t i=0; i<M; i++) P[i] = i;
+        if ((LuTag == FfpackGaussJordanSlab || LuTag == FfpackGaussJordanTile) && transform)
+            return Protected::GaussJordan(F, M, N, A, lda, 0, 0, N, P, Qt, LuTag);
+        size_t r = FFPACK::_RowEchelonForm (F, M, N, A, lda, P, Qt, transform, LuTag, psH);
+        if (LuTag == FfpackSlabRecursive){
+            // Putting Echelon in compressed triangular form : M = M Q
+            for (size_t i=0; i<r; ++i)
+                if ( Qt[i]> i )
+                    FFLAS::fswap (F, i, A + Qt[i], lda, A + i, lda );
+        }
+
+        if (transform){
+            ftrtri (F, FFLAS::FflasUpper, FFLAS::FflasUnit, r, A, lda, psH);
+            ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, N-r, F.one, A, lda, A+r, lda, psH);
+
+            ftrtrm (F, FFLAS::FflasLeft, FFLAS::FflasUnit, r, A, lda, psH);
+        } else {
+            ftrsm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, N-r, F.one, A, lda, A+r, lda, psH);
+            //FFLAS::fidentity (F, r, r, A, lda);
+            //applyP(F, FFLAS::FflasRight, FFLAS::FflasNoTrans, r, 0, (int)r, A, lda, Qt);
+        }
+        return r;
+    }
+} // FFPACK
+
 template <class Field, class PSHelper>
 inline size_t
 FFPACK::ReducedRowEchelonForm (const Field& F, const size_t M, const size_t N,
@@ -219,28 +267,9 @@ FFPACK::ReducedRowEchelonForm (const Field& F, const size_t M, const size_t N,
                                size_t* P, size_t* Qt, const bool transform,
                                const FFPACK_LU_TAG LuTag, const PSHelper& psH)
 {
-    for (size_t i=0; i<N; i++) Qt[i] = i;
-    for (size_t i=0; i<M; i++) P[i] = i;
-    if ((LuTag == FfpackGaussJordanSlab || LuTag == FfpackGaussJordanTile) && transform)
-        return Protected::GaussJordan(F, M, N, A, lda, 0, 0, N, P, Qt, LuTag);
-    size_t r = RowEchelonForm (F, M, N, A, lda, P, Qt, transform, LuTag, psH);
-    if (LuTag == FfpackSlabRecursive){
-        // Putting Echelon in compressed triangular form : M = M Q
-        for (size_t i=0; i<r; ++i)
-            if ( Qt[i]> i )
-                FFLAS::fswap (F, i, A + Qt[i], lda, A + i, lda );
-    }
-
-    if (transform){
-        ftrtri (F, FFLAS::FflasUpper, FFLAS::FflasUnit, r, A, lda);
-        ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, N-r, F.one, A, lda, A+r, lda);
-
-        ftrtrm (F, FFLAS::FflasLeft, FFLAS::FflasUnit, r, A, lda);
-    } else {
-        ftrsm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit, r, N-r, F.one, A, lda, A+r, lda);
-        //FFLAS::fidentity (F, r, r, A, lda);
-        //applyP(F, FFLAS::FflasRight, FFLAS::FflasNoTrans, r, 0, (int)r, A, lda, Qt);
-    }
+    FFPACK::Checker_echelon<Field> checker (F, M, N, A, lda, true);
+    size_t r = FFPACK::_ReducedRowEchelonForm (F, M, N, A, lda, P, Qt, transform, LuTag, psH);
+    checker.check (A, lda, r, P, Qt, transform, LuTag);
     return r;
 }
 
@@ -285,8 +314,9 @@ FFPACK::Protected::GaussJordan (const Field& F, const size_t M, const size_t N,
         /* Computes [ Y2 T2 ] in [ A22 A23 ]
          *          [ Y3    ]    [ A32 A33 ]
          */
-        size_t R = ReducedRowEchelonForm (F, M-rowbeg, colsize, A22, lda, P, Q+colbeg, true,
-                                          (LuTag==FfpackGaussJordanSlab) ? FfpackSlabRecursive : FfpackTileRecursive);
+        size_t R = FFPACK::_ReducedRowEchelonForm (F, M-rowbeg, colsize, A22, lda, P, Q+colbeg, true,
+                                                   (LuTag==FfpackGaussJordanSlab) ? FfpackSlabRecursive : FfpackTileRecursive,
+                                                   FFLAS::ParSeqHelper::Sequential());
 
         typename Field::Element_ptr A13 = A12+R;
         typename Field::Element_ptr A23 = A22+R;
@@ -442,6 +472,143 @@ namespace FFPACK{
     /*********************************************/
     /* Accessors to Triangular and Echelon forms */
     /*********************************************/
+    namespace Protected {
+
+        /* Copies and initializations of blocks for the accessors below, either sequential
+         * or split in blocks of rows, each one processed by a task */
+        template <class Field>
+        inline void
+        fassign (const Field& F, const size_t M, const size_t N,
+                 typename Field::ConstElement_ptr A, const size_t lda,
+                 typename Field::Element_ptr T, const size_t ldt,
+                 const FFLAS::ParSeqHelper::Sequential)
+        {
+            FFLAS::fassign (F, M, N, A, lda, T, ldt);
+        }
+
+        template <class Field, class Cut, class Param>
+        inline void
+        fassign (const Field& F, const size_t M, const size_t N,
+                 typename Field::ConstElement_ptr A, const size_t lda,
+                 typename Field::Element_ptr T, const size_t ldt,
+                 const FFLAS::ParSeqHelper::Parallel<Cut,Param> psH)
+        {
+            SYNCH_GROUP(
+                FORBLOCK1D(iter, M, psH,
+                           TASK(MODE(CONSTREFERENCE(F, A, T) READ(A[iter.begin()*lda]) WRITE(T[iter.begin()*ldt])),
+                                FFLAS::fassign (F, iter.end()-iter.begin(), N, A+iter.begin()*lda, lda, T+iter.begin()*ldt, ldt));
+                          );
+                       );
+        }
+
+        template <class Field>
+        inline void
+        fzero (const Field& F, const size_t M, const size_t N,
+               typename Field::Element_ptr T, const size_t ldt,
+               const FFLAS::ParSeqHelper::Sequential)
+        {
+            FFLAS::fzero (F, M, N, T, ldt);
+        }
+
+        template <class Field, class Cut, class Param>
+        inline void
+        fzero (const Field& F, const size_t M, const size_t N,
+               typename Field::Element_ptr T, const size_t ldt,
+               const FFLAS::ParSeqHelper::Parallel<Cut,Param> psH)
+        {
+            SYNCH_GROUP(
+                FORBLOCK1D(iter, M, psH,
+                           TASK(MODE(CONSTREFERENCE(F, T) WRITE(T[iter.begin()*ldt])),
+                                FFLAS::fzero (F, iter.end()-iter.begin(), N, T+iter.begin()*ldt, ldt));
+                          );
+                       );
+        }
+
+        // Rows ibeg..iend-1 of the M x N identity matrix
+        template <class Field>
+        inline void
+        identityRows (const Field& F, const size_t ibeg, const size_t iend, const size_t N,
+                      typename Field::Element_ptr T, const size_t ldt)
+        {
+            FFLAS::fzero (F, iend-ibeg, N, T+ibeg*ldt, ldt);
+            for (size_t i=ibeg; i<std::min(iend,N); ++i)
+                F.assign (*(T+i*(ldt+1)), F.one);
+        }
+
+        template <class Field>
+        inline void
+        fidentity (const Field& F, const size_t M, const size_t N,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const FFLAS::ParSeqHelper::Sequential)
+        {
+            FFLAS::fidentity (F, M, N, T, ldt);
+        }
+
+        template <class Field, class Cut, class Param>
+        inline void
+        fidentity (const Field& F, const size_t M, const size_t N,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const FFLAS::ParSeqHelper::Parallel<Cut,Param> psH)
+        {
+            SYNCH_GROUP(
+                FORBLOCK1D(iter, M, psH,
+                           TASK(MODE(CONSTREFERENCE(F, T) WRITE(T[iter.begin()*ldt])),
+                                identityRows (F, iter.begin(), iter.end(), N, T, ldt));
+                          );
+                       );
+        }
+
+        // Rows ibeg..iend-1 of getTriangular
+        template <class Field>
+        inline void
+        getTriangularRows (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                           const FFLAS::FFLAS_DIAG diag,
+                           const size_t ibeg, const size_t iend, const size_t N, const size_t R,
+                           typename Field::ConstElement_ptr A, const size_t lda,
+                           typename Field::Element_ptr T, const size_t ldt,
+                           const bool OnlyNonZeroVectors)
+        {
+            typename Field::ConstElement_ptr Ai = A + ibeg*lda;
+            typename Field::Element_ptr Ti = T + ibeg*ldt;
+            const size_t rend = std::min (iend, R);
+            const size_t i0 = std::max (ibeg, R); // first row below the triangle
+            if (Uplo == FFLAS::FflasUpper){
+                for (size_t i=ibeg; i<rend; i++, Ai += lda, Ti += ldt){
+                    //!@todo just one triangular fzero+fassign ?
+                    if (diag == FFLAS::FflasNonUnit){
+                        FFLAS::fzero(F,i,Ti,1);
+                        FFLAS::fassign (F, N-i, Ai+i, 1, Ti+i, 1);
+                    }
+                    else {
+                        FFLAS::fzero(F,i,Ti,1);
+                        F.assign (*(Ti+i), F.one);
+                        FFLAS::fassign (F, N-i-1, Ai+i+1, 1, Ti+i+1, 1);
+                    }
+                }
+                if (!OnlyNonZeroVectors && iend > i0)
+                    FFLAS::fzero(F, iend-i0, N, T+i0*ldt, ldt);
+            } else {
+                size_t maxcol = (OnlyNonZeroVectors ? R : N);
+                for (size_t i=ibeg; i<rend; i++, Ai += lda, Ti += ldt){
+                    if (diag == FFLAS::FflasNonUnit){
+                        FFLAS::fassign (F, i+1, Ai, 1, Ti, 1);
+                        FFLAS::fzero(F,maxcol-i-1,Ti+i+1,1);
+                    }
+                    else {
+                        FFLAS::fassign (F, i, Ai, 1, Ti, 1);
+                        F.assign (Ti[i], F.one);
+                        FFLAS::fzero(F,maxcol-i-1,Ti+i+1,1);
+                    }
+                }
+                if (iend > i0){
+                    FFLAS::fassign(F, iend-i0, R, A+i0*lda, lda, T+i0*ldt, ldt);
+                    if (!OnlyNonZeroVectors)
+                        FFLAS::fzero(F, iend-i0, N-R, T+i0*ldt+R, ldt);
+                }
+            }
+        }
+    } // Protected
+
     template <class Field>
     inline void
     getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
@@ -451,42 +618,38 @@ namespace FFPACK{
                    typename Field::Element_ptr T, const size_t ldt,
                    const bool OnlyNonZeroVectors)
     {
-        typename Field::ConstElement_ptr Ai = A;
-        typename Field::Element_ptr Ti = T;
-        if (Uplo == FFLAS::FflasUpper){
-            for (size_t i=0; i<R; i++, Ai += lda, Ti += ldt){
-                //!@todo just one triangular fzero+fassign ?
-                if (diag == FFLAS::FflasNonUnit){
-                    FFLAS::fzero(F,i,Ti,1);
-                    FFLAS::fassign (F, N-i, Ai+i, 1, Ti+i, 1);
-                }
-                else {
-                    FFLAS::fzero(F,i,Ti,1);
-                    F.assign (*(Ti+i), F.one);
-                    FFLAS::fassign (F, N-i-1, Ai+i+1, 1, Ti+i+1, 1);
-                }
-            }
-            if (!OnlyNonZeroVectors)
-                FFLAS::fzero(F,M-R,N,Ti,ldt);
-        } else {
-            size_t maxcol = (OnlyNonZeroVectors ? R : N);
-            for (size_t i=0; i<R; i++, Ai += lda, Ti += ldt){
-                if (diag == FFLAS::FflasNonUnit){
-                    FFLAS::fassign (F, i+1, Ai, 1, Ti, 1);
-                    FFLAS::fzero(F,maxcol-i-1,Ti+i+1,1);
-                }
-                else {
-                    FFLAS::fassign (F, i, Ai, 1, Ti, 1);
-                    F.assign (Ti[i], F.one);
-                    FFLAS::fzero(F,maxcol-i-1,Ti+i+1,1);
-                }
-            }
-            //Ti = T+R*ldt;
-            FFLAS::fassign(F, M-R, R, Ai, lda, Ti, ldt);
-            if (!OnlyNonZeroVectors)
-                FFLAS::fzero(F, M-R, N-R, Ti+R, ldt);
-        }
+        Protected::getTriangularRows (F, Uplo, diag, 0, M, N, R, A, lda, T, ldt, OnlyNonZeroVectors);
+    }
+
+    template <class Field>
+    inline void
+    getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                   const FFLAS::FFLAS_DIAG diag,
+                   const size_t M, const size_t N, const size_t R,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const bool OnlyNonZeroVectors, const FFLAS::ParSeqHelper::Sequential)
+    {
+        Protected::getTriangularRows (F, Uplo, diag, 0, M, N, R, A, lda, T, ldt, OnlyNonZeroVectors);
     }
+
+    template <class Field, class Cut, class Param>
+    inline void
+    getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                   const FFLAS::FFLAS_DIAG diag,
+                   const size_t M, const size_t N, const size_t R,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::Element_ptr T, const size_t ldt,
+                   const bool OnlyNonZeroVectors, const FFLAS::ParSeqHelper::Parallel<Cut,Param> psH)
+    {
+        SYNCH_GROUP(
+            FORBLOCK1D(iter, M, psH,
+                       TASK(MODE(CONSTREFERENCE(F, A, T) WRITE(T[iter.begin()*ldt])),
+                            Protected::getTriangularRows (F, Uplo, diag, iter.begin(), iter.end(), N, R, A, lda, T, ldt, OnlyNonZeroVectors));
+                      );
+                   );
+    }
+
     template <class Field>
     inline void
     getTriangular (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
@@ -529,7 +692,7 @@ namespace FFPACK{
         delete[] invMP;
     }
 
-    template <class Field>
+    template <class Field, class PSHelper>
     inline void
     getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                     const FFLAS::FFLAS_DIAG diag,
@@ -537,7 +700,7 @@ namespace FFPACK{
                     typename Field::ConstElement_ptr A, const size_t lda,
                     typename Field::Element_ptr T, const size_t ldt,
                     const bool OnlyNonZeroVectors,
-                    const FFPACK_LU_TAG LuTag)
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         if (LuTag != FfpackTileRecursive){
             typename Field::ConstElement_ptr Ai = A;
@@ -554,7 +717,7 @@ namespace FFPACK{
                     }
                 }
                 if (!OnlyNonZeroVectors)
-                    FFLAS::fzero(F,M-R,N,Ti,ldt);
+                    Protected::fzero (F, M-R, N, Ti, ldt, psH);
             } else { // Extracting a column echelon form
                 for (size_t i=0; i<R; i++, Ai++, Ti++){
                     size_t piv = P[i];
@@ -567,38 +730,52 @@ namespace FFPACK{
                     }
                 }
                 if (!OnlyNonZeroVectors)
-                    FFLAS::fzero(F,M,N-R,Ti,ldt);
+                    Protected::fzero (F, M, N-R, Ti, ldt, psH);
             }
         } else { // TileRecursive
-            getTriangular (F, Uplo, diag, M, N, R, A, lda, T, ldt, OnlyNonZeroVectors);
+            getTriangular (F, Uplo, diag, M, N, R, A, lda, T, ldt, OnlyNonZeroVectors, psH);
             if (Uplo == FFLAS::FflasLower){
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, OnlyNonZeroVectors ? R : N, 0, M, T, ldt, P);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, OnlyNonZeroVectors ? R : N, 0, M, T, ldt, P, psH);
 
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             } else{
-                applyP (F, FFLAS::FflasRight,FFLAS::FflasNoTrans, OnlyNonZeroVectors ? R : M, 0, N, T, ldt, P);
+                applyP (F, FFLAS::FflasRight,FFLAS::FflasNoTrans, OnlyNonZeroVectors ? R : M, 0, N, T, ldt, P, psH);
 
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasLeft,FFLAS::FflasNoTrans, N, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasLeft,FFLAS::FflasNoTrans, N, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         }
     }
+
     template <class Field>
     inline void
     getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                     const FFLAS::FFLAS_DIAG diag,
                     const size_t M, const size_t N, const size_t R, const size_t* P,
-                    typename Field::Element_ptr A, const size_t lda,
+                    typename Field::ConstElement_ptr A, const size_t lda,
+                    typename Field::Element_ptr T, const size_t ldt,
+                    const bool OnlyNonZeroVectors,
                     const FFPACK_LU_TAG LuTag)
+    {
+        getEchelonForm (F, Uplo, diag, M, N, R, P, A, lda, T, ldt, OnlyNonZeroVectors, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline void
+    getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                    const FFLAS::FFLAS_DIAG diag,
+                    const size_t M, const size_t N, const size_t R, const size_t* P,
+                    typename Field::Element_ptr A, const size_t lda,
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         if (LuTag != FfpackTileRecursive){
             typename Field::Element_ptr Ai = A;
@@ -623,21 +800,21 @@ namespace FFPACK{
             getTriangular (F, Uplo, diag, M, N, R, A, lda);
 
             if (Uplo == FFLAS::FflasLower){
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, N, 0, M, A, lda, P);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, N, 0, M, A, lda, P, psH);
 
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, A, lda, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, A, lda, LPerm, psH);
 
                 delete[] LPerm;
             } else {
-                applyP (F, FFLAS::FflasRight,FFLAS::FflasNoTrans, M, 0, N, A, lda, P);
+                applyP (F, FFLAS::FflasRight,FFLAS::FflasNoTrans, M, 0, N, A, lda, P, psH);
 
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasLeft,FFLAS::FflasNoTrans, N, 0, R, A, lda, LPerm);
+                applyP (F, FFLAS::FflasLeft,FFLAS::FflasNoTrans, N, 0, R, A, lda, LPerm, psH);
 
                 delete[] LPerm;
             }
@@ -646,131 +823,168 @@ namespace FFPACK{
 
     template <class Field>
     inline void
+    getEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                    const FFLAS::FFLAS_DIAG diag,
+                    const size_t M, const size_t N, const size_t R, const size_t* P,
+                    typename Field::Element_ptr A, const size_t lda,
+                    const FFPACK_LU_TAG LuTag)
+    {
+        getEchelonForm (F, Uplo, diag, M, N, R, P, A, lda, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline void
     getEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                          const FFLAS::FFLAS_DIAG diag,
                          const size_t M, const size_t N, const size_t R, const size_t* P, const size_t * Q,
                          typename Field::ConstElement_ptr A, const size_t lda,
                          typename Field::Element_ptr T, const size_t ldt,
-                         const FFPACK_LU_TAG LuTag)
+                         const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         FFLAS::FFLAS_DIAG oppDiag = (diag == FFLAS::FflasNonUnit) ? FFLAS::FflasUnit : FFLAS::FflasNonUnit;
         FFLAS::FFLAS_UPLO oppUpLo = (Uplo == FFLAS::FflasUpper) ? FFLAS::FflasLower: FFLAS::FflasUpper;
         size_t Tdim = (Uplo == FFLAS::FflasUpper) ? M : N;
         size_t MaxPidx = (LuTag == FfpackTileRecursive) ? Tdim : R;
 
-        getTriangular (F, oppUpLo, oppDiag, M, N, R, A, lda, T, ldt, true);
+        getTriangular (F, oppUpLo, oppDiag, M, N, R, A, lda, T, ldt, true, psH);
 
-        FFLAS::fidentity (F, Tdim-R, Tdim-R, T + R*ldt +R, ldt);
+        Protected::fidentity (F, Tdim-R, Tdim-R, T + R*ldt +R, ldt, psH);
 
         if (oppUpLo == FFLAS::FflasUpper){ // Transform of a column echelon form
-            FFLAS::fzero (F, Tdim - R, R, T + R*ldt, ldt);
+            Protected::fzero (F, Tdim - R, R, T + R*ldt, ldt, psH);
 
-            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, Tdim, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, Tdim, 0, MaxPidx, T, ldt, P, psH);
 
             if (LuTag==FfpackTileRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, Q, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, N, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, N, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         } else { // Transform of a row echelon form
-            FFLAS::fzero (F, R, Tdim - R, T + R, ldt);
+            Protected::fzero (F, R, Tdim - R, T + R, ldt, psH);
 
-            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, Tdim, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, Tdim, 0, MaxPidx, T, ldt, P, psH);
 
             if (LuTag==FfpackTileRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, Q, LPerm);
 
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, M, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, M, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         }
     }
+
     template <class Field>
     inline void
+    getEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                         const FFLAS::FFLAS_DIAG diag,
+                         const size_t M, const size_t N, const size_t R, const size_t* P, const size_t * Q,
+                         typename Field::ConstElement_ptr A, const size_t lda,
+                         typename Field::Element_ptr T, const size_t ldt,
+                         const FFPACK_LU_TAG LuTag)
+    {
+        getEchelonTransform (F, Uplo, diag, M, N, R, P, Q, A, lda, T, ldt, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline void
     getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                            const size_t M, const size_t N, const size_t R, const size_t* P,
                            typename Field::ConstElement_ptr A, const size_t lda,
                            typename Field::Element_ptr T, const size_t ldt,
                            const bool OnlyNonZeroVectors,
-                           const FFPACK_LU_TAG LuTag)
+                           const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         size_t MaxPidx = (LuTag == FfpackSlabRecursive) ? R : ((Uplo == FFLAS::FflasUpper)?N:M);
 
-        FFLAS::fidentity (F, R, R, T, ldt);
+        Protected::fidentity (F, R, R, T, ldt, psH);
 
         if (Uplo == FFLAS::FflasUpper){  // Extracting a reduced row echelon form
-            FFLAS::fassign(F, R, N-R, A+R, lda, T+R, ldt);
+            Protected::fassign (F, R, N-R, A+R, lda, T+R, ldt, psH);
 
-            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, R, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, R, 0, MaxPidx, T, ldt, P, psH);
 
             if (!OnlyNonZeroVectors)
-                FFLAS::fzero (F, M-R, N, T + R*ldt, ldt);
+                Protected::fzero (F, M-R, N, T + R*ldt, ldt, psH);
 
             if (LuTag==FfpackTileRecursive || LuTag==FfpackGaussJordanTile){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
 
         } else { // Extracting a reduced column echelon form
-            FFLAS::fassign(F, M-R, R, A+R*lda, lda, T+R*ldt, ldt);
+            Protected::fassign (F, M-R, R, A+R*lda, lda, T+R*ldt, ldt, psH);
 
-            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, R, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, R, 0, MaxPidx, T, ldt, P, psH);
 
             if (!OnlyNonZeroVectors)
-                FFLAS::fzero (F, M, N-R, T + R, ldt);
+                Protected::fzero (F, M, N-R, T + R, ldt, psH);
 
             if (LuTag==FfpackTileRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         }
     }
+
     template <class Field>
     inline void
     getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                            const size_t M, const size_t N, const size_t R, const size_t* P,
-                           typename Field::Element_ptr A, const size_t lda,
+                           typename Field::ConstElement_ptr A, const size_t lda,
+                           typename Field::Element_ptr T, const size_t ldt,
+                           const bool OnlyNonZeroVectors,
                            const FFPACK_LU_TAG LuTag)
+    {
+        getReducedEchelonForm (F, Uplo, M, N, R, P, A, lda, T, ldt, OnlyNonZeroVectors, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline void
+    getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                           const size_t M, const size_t N, const size_t R, const size_t* P,
+                           typename Field::Element_ptr A, const size_t lda,
+                           const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         size_t MaxPidx = (LuTag == FfpackSlabRecursive) ? R : ((Uplo == FFLAS::FflasUpper)?N:M);
-        FFLAS::fidentity (F, R, R, A, lda);
+        Protected::fidentity (F, R, R, A, lda, psH);
         if (Uplo == FFLAS::FflasUpper){  // Extracting a reduced row echelon form
-            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, R, 0, MaxPidx, A, lda, P);
+            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, R, 0, MaxPidx, A, lda, P, psH);
 
-            FFLAS::fzero (F, M-R, N, A + R*lda, lda);
+            Protected::fzero (F, M-R, N, A + R*lda, lda, psH);
 
             if (LuTag==FfpackTileRecursive || LuTag==FfpackGaussJordanTile){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0, R, A, lda, LPerm);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0, R, A, lda, LPerm, psH);
 
                 delete[] LPerm;
             }
 
         } else { // Extracting a reduced column echelon form
-            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, R, 0, MaxPidx, A, lda, P);
+            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, R, 0, MaxPidx, A, lda, P, psH);
 
-            FFLAS::fzero (F, M, N-R, A + R, lda);
+            Protected::fzero (F, M, N-R, A + R, lda, psH);
 
             if (LuTag!=FfpackSlabRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, P, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, A, lda, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, M, 0, R, A, lda, LPerm, psH);
 
                 delete[] LPerm;
             }
@@ -779,51 +993,72 @@ namespace FFPACK{
 
     template <class Field>
     inline void
+    getReducedEchelonForm (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                           const size_t M, const size_t N, const size_t R, const size_t* P,
+                           typename Field::Element_ptr A, const size_t lda,
+                           const FFPACK_LU_TAG LuTag)
+    {
+        getReducedEchelonForm (F, Uplo, M, N, R, P, A, lda, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline void
     getReducedEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
                                 const size_t M, const size_t N, const size_t R, const size_t* P, const size_t* Q,
                                 typename Field::ConstElement_ptr A, const size_t lda,
                                 typename Field::Element_ptr T, const size_t ldt,
-                                const FFPACK_LU_TAG LuTag)
+                                const FFPACK_LU_TAG LuTag, const PSHelper& psH)
     {
         FFLAS::FFLAS_UPLO oppUpLo = (Uplo == FFLAS::FflasUpper) ? FFLAS::FflasLower: FFLAS::FflasUpper;
         size_t Tdim = (Uplo == FFLAS::FflasUpper) ? M : N;
         size_t MaxPidx = (LuTag == FfpackTileRecursive || LuTag==FfpackGaussJordanTile) ?  Tdim : R; // maybe != FfpackGaussJordanSlab
 
-        FFLAS::fidentity (F, Tdim-R, Tdim-R, T + R*ldt +R, ldt);
+        Protected::fidentity (F, Tdim-R, Tdim-R, T + R*ldt +R, ldt, psH);
 
         if (oppUpLo == FFLAS::FflasUpper){ // Transform of a reduced column echelon form
-            FFLAS::fassign (F, R, N, A, lda, T, ldt);
+            Protected::fassign (F, R, N, A, lda, T, ldt, psH);
 
-            FFLAS::fzero (F, Tdim - R, R, T + R*ldt, ldt);
+            Protected::fzero (F, Tdim - R, R, T + R*ldt, ldt, psH);
 
-            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, Tdim, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans, Tdim, 0, MaxPidx, T, ldt, P, psH);
 
             if (LuTag==FfpackTileRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (M, R, Q, LPerm);
 
-                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, Tdim, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, Tdim, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         } else { // Transform of a reduced row echelon form
-            FFLAS::fassign (F, M, R, A, lda, T, ldt);
+            Protected::fassign (F, M, R, A, lda, T, ldt, psH);
 
-            FFLAS::fzero (F, R, Tdim - R, T + R, ldt);
+            Protected::fzero (F, R, Tdim - R, T + R, ldt, psH);
 
-            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, Tdim, 0, MaxPidx, T, ldt, P);
+            applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, Tdim, 0, MaxPidx, T, ldt, P, psH);
 
             if (LuTag!=FfpackSlabRecursive){
                 size_t * LPerm = new size_t[R];
                 PLUQtoEchelonPermutation (N, R, Q, LPerm);
 
-                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, Tdim, 0, R, T, ldt, LPerm);
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, Tdim, 0, R, T, ldt, LPerm, psH);
 
                 delete[] LPerm;
             }
         }
     }
 
+    template <class Field>
+    inline void
+    getReducedEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                                const size_t M, const size_t N, const size_t R, const size_t* P, const size_t* Q,
+                                typename Field::ConstElement_ptr A, const size_t lda,
+                                typename Field::Element_ptr T, const size_t ldt,
+                                const FFPACK_LU_TAG LuTag)
+    {
+        getReducedEchelonTransform (F, Uplo, M, N, R, P, Q, A, lda, T, ldt, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
 } // FFPACK
 #endif  // __FFLASFFPACK_ffpack_echelon_forms_INL
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
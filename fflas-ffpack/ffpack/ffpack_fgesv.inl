@@ -49,6 +49,8 @@ namespace FFPACK {
         else
             Na = N;
 
+        Checker_fgesv<Field> checker (F, Side, Na, Na, (Side == FFLAS::FflasLeft) ? N : M, A, lda, B, ldb);
+
         size_t* P = FFLAS::fflas_new<size_t>(Na);
         size_t* Q = FFLAS::fflas_new<size_t>(Na);
 
@@ -59,6 +61,8 @@ namespace FFPACK {
         FFLAS::fflas_delete( P);
         FFLAS::fflas_delete( Q);
 
+        checker.check (B, ldb, *info);
+
         return R;
     }
 
@@ -73,6 +77,8 @@ namespace FFPACK {
            int * info)
     {
 
+        Checker_fgesv<Field> checker (F, Side, M, N, NRHS, A, lda, B, ldb);
+
         size_t* P = FFLAS::fflas_new<size_t>(M);
         size_t* Q = FFLAS::fflas_new<size_t>(N);
 
@@ -83,6 +89,8 @@ namespace FFPACK {
         FFLAS::fflas_delete (P);
         FFLAS::fflas_delete (Q);
 
+        checker.check (X, ldx, *info);
+
         return R;
     }
 
@@ -114,14 +114,6 @@ namespace FFPACK {
         return 0;
     }
 
-    template <class Field>
-    inline size_t fsytrf_LOW_RPM_BC_Crout (const Field& F, const size_t N,
-                                           typename Field::Element_ptr A, const size_t lda,
-                                           typename Field::Element_ptr Dinv, const size_t incDinv,
-                                           size_t * P){
-        //  TODO
-        return 0;
-    }
     template <class Field>
     inline size_t fsytrf_UP_RPM_BC_Crout (const Field& F, const size_t N,
                                           typename Field::Element_ptr A, const size_t lda,
@@ -319,116 +311,23 @@ namespace FFPACK {
         return (size_t) rank;
     }
 
-    template <class Field>
-    inline size_t fsytrf_UP_RPM (const Field& Fi, const size_t N,
-                                 typename Field::Element_ptr A, const size_t lda,
-                                 typename Field::Element_ptr Dinv, const size_t incDinv,
-                                 size_t * P, size_t BCThreshold){
-        if (N < BCThreshold){
-            return fsytrf_UP_RPM_BC_Crout (Fi,N,A,lda,Dinv,incDinv,P);
-        }
-        std::vector<bool> twoBlocks(N,false);
-
-        size_t N1 = N>>1;
-        size_t N2 = N-N1;
-        size_t * P1 = FFLAS::fflas_new<size_t >(N1);
-        size_t R1,R2,R3;
-
-        // A1 = P1^T [ U1^T ] D1 [ U1 V1 ] P1
-        //           [ V1^T ]
-        R1 = fsytrf_UP_RPM (Fi, N1, A, lda, Dinv, incDinv, P1, BCThreshold);
-        // locate the 2x2 blocks
-        for (size_t i=0; i<R1; i++)
-            if (int(P1[i])<0){
-                P1[i]=-P1[i]-1;
-                twoBlocks[i] = i? (!twoBlocks[i-1]) : true; // mark the first of the 2 positions
-            }
-
+    /* Turns the output of the three recursive steps of fsytrf_UP_RPM into the factorization of the whole
+     * matrix: interleaves the 2x2 blocks of the second step with the other pivots and builds P.
+     * Deletes the permutations P1, P2, P3 and Q2.
+     */
+    template <class Field, class PSHelper>
+    inline size_t fsytrf_UP_RPM_reassemble (const Field& Fi, const size_t N, const size_t N1,
+                                            const size_t R1, const size_t R2, const size_t R3,
+                                            typename Field::Element_ptr A, const size_t lda,
+                                            size_t * P1, size_t * P2, size_t * P3, size_t * Q2,
+                                            std::vector<bool>& twoBlocks, size_t * P,
+                                            const PSHelper& psH){
+        const size_t N2 = N-N1;
         typename Field::Element_ptr A2 = A + N1;
         typename Field::Element_ptr A4 = A2 + N1*lda;
-        // [ B1 ] <- P1^T A2
-        // [ B2 ]
-        applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, 0, N1, A2, lda, P1);
-
-        typename Field::Element_ptr B1 = A2;
-        typename Field::Element_ptr B2 = B1 + R1*lda;
-        /*     [ U1 V1 | B1 ]
-         *     [    0  | B2 ]
-         *     [ ------|--- ]
-         *     [    0  | A4 ]
-         *
-         */
-        // C <- U1^-T B1
-        ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R1, N2, Fi.one, A, lda, B1, lda);
-        // F <- B2 - V1^T C
-        fgemm (Fi, FFLAS::FflasTrans, FFLAS::FflasNoTrans, N1-R1, N2, R1, Fi.mOne, A + R1, lda, B1, lda, Fi.one, B2, lda);
-
-        // G <- A4 - C^T D1^-1 C
-        // E <- D1^-1 C (done simultaneously)
-        fsyrk (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2, R1, Fi.mOne, B1, lda, A, lda+1, twoBlocks, Fi.one, A4, lda);
-
-        /*     [ U1 V1 | E ]
-         *     [    0  | F ]
-         *     [ ------|-- ]
-         *     [    0  | G ]
-         */
-        // F = P2 [ L2 ] [ U2 V2 ] Q2
-        //        [ M2 ]
-        size_t * P2 = FFLAS::fflas_new<size_t >(N1-R1);
-        size_t * Q2 = FFLAS::fflas_new<size_t >(N2);
-        typename Field::Element_ptr F=A2+R1*lda;
-        R2 = _PLUQ (Fi, FFLAS::FflasUnit, N1-R1, N2, F, lda, P2, Q2, BCThreshold);
-
+        typename Field::Element_ptr F = A2 + R1*lda;
         typename Field::Element_ptr H1 = A4, H2 = H1+R2, H3 = H2+R2*lda;
 
-        if (R2){
-            // [ G1   G2 ] <- Q2 G Q2^T
-            // [ G2^T G3 ]
-            // temporarily copy G2 over G2^T to please std applyP
-            // TODO: write a symmetric applyP
-            for (size_t i=0; i<N2; i++)
-                FFLAS::fassign(Fi, N2-i-1, A4+i*(lda+1)+1, 1, A4+i*(lda+1)+lda, lda);
-
-            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, N2, size_t(0), N2, A4, lda, Q2);
-            applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, size_t(0), N2, A4, lda, Q2);
-
-            // [ E1 E2 ] <- E Q2^T
-            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N2, A2, lda, Q2);
-
-            // [ V11 V12 ] <- V1 P2^T
-            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N1-R1, A+R1, lda, P2);
-
-            // H1 <- upper tri such that U2^TxH1 + H1^T x U2= G1
-            ftrssyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasUnit, R2, F, lda, A4, lda);
-
-            // H2 <-  U2^-T (G2 - H1^T V2)
-            FFLAS::ftrmm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R2, N2-R2, Fi.mOne, A4, lda, F+R2, lda, Fi.one, H2, lda);
-            FFLAS::ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasUnit, R2, N2-R2, Fi.one, F, lda, H2, lda);
-
-            // H3 <- G3 - (V2^T H2 + H2^T V2)
-            fsyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2-R2, R2, Fi.mOne, F+R2, lda, H2, lda, Fi.one, H3, lda);
-
-            // U2' V2'  <-  D2 *  [U2 V2]
-            typename Field::Element_ptr D2i = F, Dinvi = Dinv+R1*incDinv, H2i=H2;
-            for (size_t i=0; i<R2; i++, Dinvi+=2, D2i+=lda+1, H2i+=lda){
-                Fi.inv (*(Dinvi), *D2i);
-                Fi.assign(*(Dinvi+1), *Dinvi);
-                FFLAS::fscalin (Fi, N2-i-1, *D2i, D2i+1, 1);
-            }
-        }
-        /*     [ U1 V1 | E1      E2 ]
-         *     [    0  | L2 \ U2 V2 ]
-         *     [    0  | M2     0   ]
-         *     [ ------|----------- ]
-         *     [    0  | H1     H2  ]
-         *     [    0  |        H3  ]
-         */
-        size_t * P3 = FFLAS::fflas_new<size_t >(N2-R2);
-
-        // H3 = P3^T [ U3^T ] D3 [ U3 V3 ] P3
-        //           [ V3^T ]
-        R3 = fsytrf_UP_RPM (Fi, N2-R2, H3, lda, Dinv+R1+2*R2, incDinv, P3, BCThreshold);
-
         // locate the 2x2 blocks
         for (size_t j=R1; j<R1+2*R2; j+=2)
             twoBlocks[j] = true;
@@ -442,8 +341,8 @@ namespace FFPACK {
         // [ V21 V22 ]  <- [ V2 ] P3^T
         // [  0   0  ]     [  0 ]
         // [ H21 H22 ]     [ H2 ]
-        applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1+R2, 0, N2-R2, A2+R2, lda, P3);
-        applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R2,    0, N2-R2, H2, lda, P3);
+        applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1+R2, 0, N2-R2, A2+R2, lda, P3, psH);
+        applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R2,    0, N2-R2, H2, lda, P3, psH);
 
         // P <- Diag (P1 [ I_R1    ] , P3 [ I_R3    ])
         //               [      P2 ]      [      P4 ]
@@ -578,6 +477,291 @@ namespace FFPACK {
         return R1+2*R2+R3;
     }
 
+    template <class Field>
+    inline size_t fsytrf_UP_RPM (const Field& Fi, const size_t N,
+                                 typename Field::Element_ptr A, const size_t lda,
+                                 typename Field::Element_ptr Dinv, const size_t incDinv,
+                                 size_t * P, size_t BCThreshold){
+        if (N < BCThreshold){
+            return fsytrf_UP_RPM_BC_Crout (Fi,N,A,lda,Dinv,incDinv,P);
+        }
+        std::vector<bool> twoBlocks(N,false);
+
+        size_t N1 = N>>1;
+        size_t N2 = N-N1;
+        size_t * P1 = FFLAS::fflas_new<size_t >(N1);
+        size_t R1,R2,R3;
+
+        // A1 = P1^T [ U1^T ] D1 [ U1 V1 ] P1
+        //           [ V1^T ]
+        R1 = fsytrf_UP_RPM (Fi, N1, A, lda, Dinv, incDinv, P1, BCThreshold);
+        // locate the 2x2 blocks
+        for (size_t i=0; i<R1; i++)
+            if (int(P1[i])<0){
+                P1[i]=-P1[i]-1;
+                twoBlocks[i] = i? (!twoBlocks[i-1]) : true; // mark the first of the 2 positions
+            }
+
+        typename Field::Element_ptr A2 = A + N1;
+        typename Field::Element_ptr A4 = A2 + N1*lda;
+        // [ B1 ] <- P1^T A2
+        // [ B2 ]
+        applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, 0, N1, A2, lda, P1);
+
+        typename Field::Element_ptr B1 = A2;
+        typename Field::Element_ptr B2 = B1 + R1*lda;
+        /*     [ U1 V1 | B1 ]
+         *     [    0  | B2 ]
+         *     [ ------|--- ]
+         *     [    0  | A4 ]
+         *
+         */
+        // C <- U1^-T B1
+        ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R1, N2, Fi.one, A, lda, B1, lda);
+        // F <- B2 - V1^T C
+        fgemm (Fi, FFLAS::FflasTrans, FFLAS::FflasNoTrans, N1-R1, N2, R1, Fi.mOne, A + R1, lda, B1, lda, Fi.one, B2, lda);
+
+        // G <- A4 - C^T D1^-1 C
+        // E <- D1^-1 C (done simultaneously)
+        fsyrk (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2, R1, Fi.mOne, B1, lda, A, lda+1, twoBlocks, Fi.one, A4, lda);
+
+        /*     [ U1 V1 | E ]
+         *     [    0  | F ]
+         *     [ ------|-- ]
+         *     [    0  | G ]
+         */
+        // F = P2 [ L2 ] [ U2 V2 ] Q2
+        //        [ M2 ]
+        size_t * P2 = FFLAS::fflas_new<size_t >(N1-R1);
+        size_t * Q2 = FFLAS::fflas_new<size_t >(N2);
+        typename Field::Element_ptr F=A2+R1*lda;
+        R2 = _PLUQ (Fi, FFLAS::FflasUnit, N1-R1, N2, F, lda, P2, Q2, BCThreshold);
+
+        typename Field::Element_ptr H1 = A4, H2 = H1+R2, H3 = H2+R2*lda;
+
+        if (R2){
+            // [ G1   G2 ] <- Q2 G Q2^T
+            // [ G2^T G3 ]
+            // temporarily copy G2 over G2^T to please std applyP
+            // TODO: write a symmetric applyP
+            for (size_t i=0; i<N2; i++)
+                FFLAS::fassign(Fi, N2-i-1, A4+i*(lda+1)+1, 1, A4+i*(lda+1)+lda, lda);
+
+            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, N2, size_t(0), N2, A4, lda, Q2);
+            applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, size_t(0), N2, A4, lda, Q2);
+
+            // [ E1 E2 ] <- E Q2^T
+            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N2, A2, lda, Q2);
+
+            // [ V11 V12 ] <- V1 P2^T
+            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N1-R1, A+R1, lda, P2);
+
+            // H1 <- upper tri such that U2^TxH1 + H1^T x U2= G1
+            ftrssyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasUnit, R2, F, lda, A4, lda);
+
+            // H2 <-  U2^-T (G2 - H1^T V2)
+            FFLAS::ftrmm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R2, N2-R2, Fi.mOne, A4, lda, F+R2, lda, Fi.one, H2, lda);
+            FFLAS::ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasUnit, R2, N2-R2, Fi.one, F, lda, H2, lda);
+
+            // H3 <- G3 - (V2^T H2 + H2^T V2)
+            fsyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2-R2, R2, Fi.mOne, F+R2, lda, H2, lda, Fi.one, H3, lda);
+
+            // U2' V2'  <-  D2 *  [U2 V2]
+            typename Field::Element_ptr D2i = F, Dinvi = Dinv+R1*incDinv, H2i=H2;
+            for (size_t i=0; i<R2; i++, Dinvi+=2, D2i+=lda+1, H2i+=lda){
+                Fi.inv (*(Dinvi), *D2i);
+                Fi.assign(*(Dinvi+1), *Dinvi);
+                FFLAS::fscalin (Fi, N2-i-1, *D2i, D2i+1, 1);
+            }
+        }
+        /*     [ U1 V1 | E1      E2 ]
+         *     [    0  | L2 \ U2 V2 ]
+         *     [    0  | M2     0   ]
+         *     [ ------|----------- ]
+         *     [    0  | H1     H2  ]
+         *     [    0  |        H3  ]
+         */
+        size_t * P3 = FFLAS::fflas_new<size_t >(N2-R2);
+
+        // H3 = P3^T [ U3^T ] D3 [ U3 V3 ] P3
+        //           [ V3^T ]
+        R3 = fsytrf_UP_RPM (Fi, N2-R2, H3, lda, Dinv+R1+2*R2, incDinv, P3, BCThreshold);
+
+        return fsytrf_UP_RPM_reassemble (Fi, N, N1, R1, R2, R3, A, lda, P1, P2, P3, Q2, twoBlocks, P,
+                                          FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field>
+    inline size_t fsytrf_UP_RPM (const Field& Fi, const size_t N,
+                                 typename Field::Element_ptr A, const size_t lda,
+                                 typename Field::Element_ptr Dinv, const size_t incDinv,
+                                 size_t * P, size_t BCThreshold,
+                                 const FFLAS::ParSeqHelper::Sequential&){
+        return fsytrf_UP_RPM (Fi, N, A, lda, Dinv, incDinv, P, BCThreshold);
+    }
+
+    /* Same recursion as above, scheduled as a task graph: the trailing update of G by fsyrk runs
+     * concurrently with the PLUQ factorization of the off-diagonal panel F (lookahead), the
+     * permutations of G, E and V1 are independent tasks, and the other steps use the parallel
+     * BLAS kernels. The rank profile matrix is the one of the sequential version.
+     */
+    template <class Field, class Cut, class Param>
+    inline size_t fsytrf_UP_RPM (const Field& Fi, const size_t N,
+                                 typename Field::Element_ptr A, const size_t lda,
+                                 typename Field::Element_ptr Dinv, const size_t incDinv,
+                                 size_t * P, size_t BCThreshold,
+                                 const FFLAS::ParSeqHelper::Parallel<Cut,Param>& par){
+        int nt = par.numthreads();
+        if (N < BCThreshold || nt <= 1)
+            return fsytrf_UP_RPM (Fi, N, A, lda, Dinv, incDinv, P, BCThreshold);
+
+        std::vector<bool> twoBlocks(N,false);
+
+        size_t N1 = N>>1;
+        size_t N2 = N-N1;
+        size_t * P1 = FFLAS::fflas_new<size_t >(N1);
+        size_t R1,R2,R3;
+
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                               FFLAS::StrategyParameter::Threads> PermParH (nt);
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                               FFLAS::StrategyParameter::Threads> PermParH1 (std::max(nt/2,1));
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                               FFLAS::StrategyParameter::Threads> PermParH2 (std::max(nt-nt/2,1));
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                               FFLAS::StrategyParameter::Threads> TRSMParH (nt);
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                               FFLAS::StrategyParameter::TwoDAdaptive> MMParH (nt);
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                               FFLAS::StrategyParameter::Threads> SYRKParH (std::max(nt-nt/2,1));
+        typename FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                               FFLAS::StrategyParameter::Threads> PLUQParH (std::max(nt/2,1));
+
+        // A1 = P1^T [ U1^T ] D1 [ U1 V1 ] P1
+        //           [ V1^T ]
+        R1 = fsytrf_UP_RPM (Fi, N1, A, lda, Dinv, incDinv, P1, BCThreshold, par);
+        // locate the 2x2 blocks
+        for (size_t i=0; i<R1; i++)
+            if (int(P1[i])<0){
+                P1[i]=-P1[i]-1;
+                twoBlocks[i] = i? (!twoBlocks[i-1]) : true; // mark the first of the 2 positions
+            }
+
+        typename Field::Element_ptr A2 = A + N1;
+        typename Field::Element_ptr A4 = A2 + N1*lda;
+        typename Field::Element_ptr B1 = A2;
+        typename Field::Element_ptr B2 = B1 + R1*lda;
+        typename Field::Element_ptr F = B2;
+        size_t * P2 = FFLAS::fflas_new<size_t >(N1-R1);
+        size_t * Q2 = FFLAS::fflas_new<size_t >(N2);
+
+        SYNCH_GROUP(
+                    // [ B1 ] <- P1^T A2
+                    // [ B2 ]
+                    applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, 0, N1, A2, lda, P1, PermParH);
+                    // C <- U1^-T B1
+                    FFLAS::ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R1, N2, Fi.one, A, lda, B1, lda, TRSMParH);
+                    // F <- B2 - V1^T C
+                    FFLAS::fgemm (Fi, FFLAS::FflasTrans, FFLAS::FflasNoTrans, N1-R1, N2, R1, Fi.mOne, A + R1, lda, B1, lda, Fi.one, B2, lda, MMParH);
+
+                    // G <- A4 - C^T D1^-1 C
+                    // E <- D1^-1 C (done simultaneously)
+                    TASK(MODE(READ(A[0]) READWRITE(B1[0], A4[0]) CONSTREFERENCE(Fi, twoBlocks, SYRKParH)),
+                         FFLAS::fsyrk (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2, R1, Fi.mOne, B1, lda, A, lda+1, twoBlocks, Fi.one, A4, lda, SYRKParH));
+                    // F = P2 [ L2 ] [ U2 V2 ] Q2
+                    //        [ M2 ]
+                    TASK(MODE(READWRITE(F[0], P2, Q2) WRITE(R2) CONSTREFERENCE(Fi, F, P2, Q2, R2, PLUQParH)),
+                         R2 = PLUQ (Fi, FFLAS::FflasUnit, N1-R1, N2, F, lda, P2, Q2, PLUQParH));
+                   );
+
+        typename Field::Element_ptr H1 = A4, H2 = H1+R2, H3 = H2+R2*lda;
+
+        if (R2){
+            // temporarily copy G2 over G2^T to please std applyP
+            for (size_t i=0; i<N2; i++)
+                FFLAS::fassign(Fi, N2-i-1, A4+i*(lda+1)+1, 1, A4+i*(lda+1)+lda, lda);
+
+            SYNCH_GROUP(
+                        // [ G1   G2 ] <- Q2 G Q2^T
+                        // [ G2^T G3 ]
+                        TASK(MODE(READ(Q2) READWRITE(A4[0]) CONSTREFERENCE(Fi, Q2, A4, PermParH1)),
+                             {
+                             applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, N2, size_t(0), N2, A4, lda, Q2, PermParH1);
+                             applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N2, size_t(0), N2, A4, lda, Q2, PermParH1);
+                             });
+                        // [ E1 E2 ] <- E Q2^T
+                        TASK(MODE(READ(Q2) READWRITE(A2[0]) CONSTREFERENCE(Fi, Q2, A2, PermParH2)),
+                             applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N2, A2, lda, Q2, PermParH2));
+                        // [ V11 V12 ] <- V1 P2^T
+                        TASK(MODE(READ(P2) READWRITE(A[R1]) CONSTREFERENCE(Fi, P2, A)),
+                             applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, R1, size_t(0), N1-R1, A+R1, lda, P2));
+                       );
+
+            // H1 <- upper tri such that U2^TxH1 + H1^T x U2= G1
+            ftrssyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasUnit, R2, F, lda, A4, lda);
+
+            // H2 <-  U2^-T (G2 - H1^T V2)
+            FFLAS::ftrmm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasNonUnit, R2, N2-R2, Fi.mOne, A4, lda, F+R2, lda, Fi.one, H2, lda);
+            FFLAS::ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasTrans, FFLAS::FflasUnit, R2, N2-R2, Fi.one, F, lda, H2, lda, TRSMParH);
+
+            // H3 <- G3 - (V2^T H2 + H2^T V2)
+            FFLAS::fsyr2k (Fi, FFLAS::FflasUpper, FFLAS::FflasTrans, N2-R2, R2, Fi.mOne, F+R2, lda, H2, lda, Fi.one, H3, lda, SYRKParH);
+
+            // U2' V2'  <-  D2 *  [U2 V2]
+            typename Field::Element_ptr D2i = F, Dinvi = Dinv+R1*incDinv;
+            for (size_t i=0; i<R2; i++, Dinvi+=2, D2i+=lda+1){
+                Fi.inv (*(Dinvi), *D2i);
+                Fi.assign(*(Dinvi+1), *Dinvi);
+                FFLAS::fscalin (Fi, N2-i-1, *D2i, D2i+1, 1);
+            }
+        }
+        size_t * P3 = FFLAS::fflas_new<size_t >(N2-R2);
+
+        // H3 = P3^T [ U3^T ] D3 [ U3 V3 ] P3
+        //           [ V3^T ]
+        R3 = fsytrf_UP_RPM (Fi, N2-R2, H3, lda, Dinv+R1+2*R2, incDinv, P3, BCThreshold, par);
+
+        return fsytrf_UP_RPM_reassemble (Fi, N, N1, R1, R2, R3, A, lda, P1, P2, P3, Q2, twoBlocks, P, PermParH);
+    }
+
+    /* Swaps the strict lower and strict upper triangles of A in place (A <- A^T), by pairs of square
+     * tiles small enough to stay in cache, instead of walking whole columns.
+     */
+    template <class Field>
+    inline void fsytrf_transpose_triangles (const Field& Fi, const size_t N,
+                                            typename Field::Element_ptr A, const size_t lda){
+        const size_t bs = 64;
+        for (size_t I=0; I<N; I+=bs){
+            const size_t nI = std::min (bs, N-I);
+            // diagonal tile
+            for (size_t i=I; i<I+nI; i++)
+                FFLAS::fswap (Fi, I+nI-i-1, A+i*(lda+1)+1, 1, A+i*(lda+1)+lda, lda);
+            // off diagonal tiles of the block row I and the block column I
+            for (size_t J=I+nI; J<N; J+=bs){
+                const size_t nJ = std::min (bs, N-J);
+                for (size_t i=I; i<I+nI; i++)
+                    FFLAS::fswap (Fi, nJ, A+i*lda+J, 1, A+J*lda+i, lda);
+            }
+        }
+    }
+
+    /* The lower triangle of a symmetric matrix stored by rows is its upper triangle stored by columns:
+     * A = P^T L D L^T P is computed as the transpose of the factorization of the upper triangle, the
+     * matrix being transposed in place before and after. As the upper version uses the strict lower
+     * triangle as a workspace, this one uses the strict upper triangle: it is not read, and is
+     * overwritten.
+     */
+    template <class Field, class PSHelper>
+    inline size_t fsytrf_LOW_RPM (const Field& Fi, const size_t N,
+                                  typename Field::Element_ptr A, const size_t lda,
+                                  typename Field::Element_ptr Dinv, const size_t incDinv,
+                                  size_t * P, size_t BCThreshold, const PSHelper& psH){
+        fsytrf_transpose_triangles (Fi, N, A, lda);
+        size_t R = fsytrf_UP_RPM (Fi, N, A, lda, Dinv, incDinv, P, BCThreshold, psH);
+        fsytrf_transpose_triangles (Fi, N, A, lda);
+        return R;
+    }
+
     template <class Field>
     inline bool fsytrf_nonunit (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                                 typename Field::Element_ptr A, const size_t lda,
@@ -669,8 +853,11 @@ namespace FFPACK {
             FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,FFLAS::StrategyParameter::Threads> trsmPSH (par.numthreads());
             FFLAS::ftrsm (F, side, UpLo, FFLAS::FflasTrans, FFLAS::FflasNonUnit, Arows, Acols, F.one, A, lda, A12, lda, trsmPSH );
 
-            // A22 <- A22 - A12^T x D1 x A12 and A12 <- A12
-            FFLAS::fsyrk (F, UpLo, trans, N2, N1, F.mOne, A12, lda, A, lda+1, F.one, A22, lda, par);
+            // A22 <- A22 - A12^T x D1 x A12 and A12 <- A12, with the Strassen-like product on large updates
+            if (FFLAS::Protected::WinogradSteps (F, std::min (N1, N2)))
+                FFLAS::fsyrk_strassen (F, UpLo, trans, N2, N1, F.mOne, A12, lda, A, lda+1, F.one, A22, lda, par);
+            else
+                FFLAS::fsyrk (F, UpLo, trans, N2, N1, F.mOne, A12, lda, A, lda+1, F.one, A22, lda, par);
 
             // A22 = U2^T x D2^-1 x U2
             if (!fsytrf_nonunit (F, UpLo, N2, A22, lda, Dinv+N1, incDinv, par, threshold)) return false;
@@ -690,6 +877,7 @@ namespace FFPACK {
                         typename Field::Element_ptr A, const size_t lda,
                         const FFLAS::ParSeqHelper::Sequential seq,
                         size_t threshold){
+        Checker_fsytrf<Field> checker (F, UpLo, N, A, lda);
         typename Field::Element_ptr Dinv = FFLAS::fflas_new(F,N);
         bool success = fsytrf_nonunit (F, UpLo, N, A, lda, Dinv, 1, seq, threshold);
         if (!success) return false;
@@ -697,6 +885,7 @@ namespace FFPACK {
         for (size_t i=0; i<N; i++)
             FFLAS::fscalin (F, N-i-1, Dinv[i], A+i*(lda+1)+incA, incA);
         FFLAS::fflas_delete(Dinv);
+        checker.check (A, lda, success);
         return true;
     }
 
@@ -705,6 +894,7 @@ namespace FFPACK {
                         typename Field::Element_ptr A, const size_t lda,
                         const FFLAS::ParSeqHelper::Parallel<Cut,Param> par,
                         size_t threshold){
+        Checker_fsytrf<Field> checker (F, UpLo, N, A, lda);
         typename Field::Element_ptr Dinv = FFLAS::fflas_new(F,N);
         bool success = fsytrf_nonunit (F, UpLo, N, A, lda, Dinv, 1, par, threshold);
         if (!success) return false;
@@ -712,20 +902,20 @@ namespace FFPACK {
         for (size_t i=0; i<N; i++)
             FFLAS::fscalin (F, N-i-1, Dinv[i], A+i*(lda+1)+incA, incA);
         FFLAS::fflas_delete(Dinv);
+        checker.check (A, lda, success);
         return true;
     }
-    template <class Field>
+    template <class Field, class PSHelper>
     inline size_t fsytrf_RPM (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                               typename Field::Element_ptr A, const size_t lda,
-                              size_t * P, size_t threshold){
+                              size_t * P, const PSHelper& psH, size_t threshold){
         typename Field::Element_ptr Dinv = FFLAS::fflas_new(F,N);
         size_t rank;
         if (UpLo==FFLAS::FflasUpper)
             //            rank = fsytrf_UP_RPM_BC_Crout (F, N, A, lda, Dinv, 1, P, threshold);
-            rank = fsytrf_UP_RPM (F, N, A, lda, Dinv, 1, P, threshold);
+            rank = fsytrf_UP_RPM (F, N, A, lda, Dinv, 1, P, threshold, psH);
         else
-            rank = fsytrf_LOW_RPM_BC_Crout (F, N, A, lda, Dinv, 1, P);
-        //rank = fsytrf_LOW_RPM (F, N, A, lda, Dinv, 1, P, P, threshold);
+            rank = fsytrf_LOW_RPM (F, N, A, lda, Dinv, 1, P, threshold, psH);
 
         // FFLAS::WriteMatrix(std::cerr<<"After fsytrf_nonunit A = "<<std::endl,F,N,N,A, lda);
         // FFLAS::WriteMatrix(std::cerr<<"After fsytrf_nonunit Dinv = "<<std::endl,F,1,N,Dinv, 1);
@@ -736,6 +926,13 @@ namespace FFPACK {
         return rank;
     }
 
+    template <class Field>
+    inline size_t fsytrf_RPM (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
+                              typename Field::Element_ptr A, const size_t lda,
+                              size_t * P, size_t threshold){
+        return fsytrf_RPM (F, UpLo, N, A, lda, P, FFLAS::ParSeqHelper::Sequential(), threshold);
+    }
+
     template <class Field>
     inline void
     getTridiagonal (const Field& F, const size_t N, const size_t R,
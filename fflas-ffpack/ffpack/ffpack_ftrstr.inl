@@ -82,6 +82,69 @@ namespace FFPACK {
         }
     }
 
+
+    template<class Field>
+    inline void ftrstr (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_UPLO UpLo,
+                        const FFLAS::FFLAS_DIAG diagA, const FFLAS::FFLAS_DIAG diagB, const size_t N,
+                        typename Field::ConstElement_ptr A, const size_t lda,
+                        typename Field::Element_ptr B, const size_t ldb,
+                        const FFLAS::ParSeqHelper::Sequential&, const size_t threshold) {
+        ftrstr (F, side, UpLo, diagA, diagB, N, A, lda, B, ldb, threshold);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void ftrstr (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_UPLO UpLo,
+                        const FFLAS::FFLAS_DIAG diagA, const FFLAS::FFLAS_DIAG diagB, const size_t N,
+                        typename Field::ConstElement_ptr A, const size_t lda,
+                        typename Field::Element_ptr B, const size_t ldb,
+                        const FFLAS::ParSeqHelper::Parallel<Cut,Param>& PSH, const size_t threshold) {
+
+        const size_t nt = PSH.numthreads();
+        if (N <= std::max (threshold, size_t(1)) || nt <= 1){
+            ftrstr (F, side, UpLo, diagA, diagB, N, A, lda, B, ldb, threshold);
+            return;
+        }
+        size_t N1 = N>>1;
+        size_t N2 = N - N1;
+        FFLAS::FFLAS_SIDE oppSide = (side == FFLAS::FflasLeft) ? FFLAS::FflasRight: FFLAS::FflasLeft;
+        size_t A2rowdim = (UpLo == FFLAS::FflasUpper)? N1 : N2;
+        size_t A2coldim = (UpLo == FFLAS::FflasUpper)? N2 : N1;
+        FFLAS::FFLAS_DIAG diagX = (diagA != diagB)? FFLAS::FflasNonUnit : diagA;
+        typename Field::ConstElement_ptr A2;
+        typename Field::Element_ptr B2;
+        if (UpLo == FFLAS::FflasUpper){ A2 = A + N1; B2 = B + N1;}
+        else { A2 = A + N1*lda; B2 = B + N1*ldb;}
+        typename Field::ConstElement_ptr A3 = A + N1*(lda+1);
+        typename Field::Element_ptr B3 = B + N1*(ldb+1);
+        const bool useB3 = (UpLo == FFLAS::FflasUpper && side==FFLAS::FflasLeft) ||
+                           (UpLo == FFLAS::FflasLower && side==FFLAS::FflasRight);
+        typename Field::ConstElement_ptr Asolve = useB3 ? A : A3;
+        typename Field::Element_ptr Bmul = useB3 ? B3 : B;
+
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH1 (std::max(nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH2 (std::max(nt-nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                      FFLAS::StrategyParameter::Threads> TRSMParH (nt);
+        FFLAS::TRMMHelper<FFLAS::StructureHelper::Iterative,
+                          FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                                        FFLAS::StrategyParameter::Threads> > TRMMParH (TRSMParH);
+
+        SYNCH_GROUP(
+                    // B1 <- A1^-1 . B1 and B3 <- A3^-1 . B3
+                    TASK(MODE(READ(A[0]) READWRITE(B[0]) CONSTREFERENCE(F, RecParH1)),
+                         ftrstr (F, side, UpLo, diagA, diagB, N1, A, lda, B, ldb, RecParH1, threshold));
+                    TASK(MODE(READ(A3[0]) READWRITE(B3[0]) CONSTREFERENCE(F, RecParH2)),
+                         ftrstr (F, side, UpLo, diagA, diagB, N2, A3, lda, B3, ldb, RecParH2, threshold));
+                    CHECK_DEPENDENCIES;
+                    // B2 <- B2 - A2 . B3 (resp. B1)
+                    ftrmm (F, oppSide, UpLo, FFLAS::FflasNoTrans, diagX, A2rowdim, A2coldim, F.mOne, Bmul, ldb, A2, lda, F.one, B2, ldb, TRMMParH);
+                    // B2 <- A1^-1 . B2 (resp. A3^-1)
+                    ftrsm (F, side, UpLo, FFLAS::FflasNoTrans, diagA, A2rowdim, A2coldim, F.one, Asolve, lda, B2, ldb, TRSMParH);
+                   );
+    }
+
 } // FFPACK
 
 #endif // __FFLASFFPACK_ffpack_ftrstr_INL
@@ -148,6 +148,173 @@ namespace FFPACK {
         //invL(F,N,L,ldl,X,ldx);
     }
 
+    template<class Field>
+    inline void
+    ftrtri (const Field& F, const FFLAS::FFLAS_UPLO Uplo, const FFLAS::FFLAS_DIAG Diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Sequential&, const size_t threshold)
+    {
+        ftrtri (F, Uplo, Diag, N, A, lda, threshold);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrtri (const Field& F, const FFLAS::FFLAS_UPLO Uplo, const FFLAS::FFLAS_DIAG Diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Parallel<Cut,Param>& PSH, const size_t threshold)
+    {
+        const size_t nt = PSH.numthreads();
+        if (N <= threshold || nt <= 1){
+            ftrtri (F, Uplo, Diag, N, A, lda, threshold);
+            return;
+        }
+        size_t N1 = N/2;
+        size_t N2 = N - N1;
+        typename Field::Element_ptr A1 = A;
+        typename Field::Element_ptr A2 = (Uplo == FFLAS::FflasUpper) ? A + N1 : A + N1*lda;
+        typename Field::Element_ptr A3 = A + N1*(lda+1);
+
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH1 (std::max(nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH2 (std::max(nt-nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                      FFLAS::StrategyParameter::Threads> TRSMParH (std::max(nt-nt/2,(size_t)1));
+
+        // The off-diagonal block X2 = - A1^-1 A2 A3^-1 is computed in two steps, each one
+        // running concurrently with the inversion of one of the diagonal blocks
+        if (Uplo == FFLAS::FflasUpper){
+            SYNCH_GROUP(
+                        // A2 <- - A2 A3^-1 and A1 <- A1^-1
+                        TASK(MODE(READ(A3[0]) READWRITE(A2[0]) CONSTREFERENCE(F, TRSMParH)),
+                             ftrsm (F, FFLAS::FflasRight, Uplo, FFLAS::FflasNoTrans, Diag, N1, N2,
+                                    F.mOne, A3, lda, A2, lda, TRSMParH));
+                        TASK(MODE(READWRITE(A1[0]) CONSTREFERENCE(F, RecParH1)),
+                             ftrtri (F, Uplo, Diag, N1, A1, lda, RecParH1, threshold));
+                        CHECK_DEPENDENCIES;
+                        // A2 <- A1^-1 A2 and A3 <- A3^-1
+                        TASK(MODE(READ(A1[0]) READWRITE(A2[0]) CONSTREFERENCE(F, RecParH1)),
+                             ftrmm (F, FFLAS::FflasLeft, Uplo, FFLAS::FflasNoTrans, Diag, N1, N2,
+                                    F.one, A1, lda, A2, lda, RecParH1));
+                        TASK(MODE(READWRITE(A3[0]) CONSTREFERENCE(F, RecParH2)),
+                             ftrtri (F, Uplo, Diag, N2, A3, lda, RecParH2, threshold));
+                       );
+        }
+        else {
+            SYNCH_GROUP(
+                        // A2 <- - A2 A1^-1 and A3 <- A3^-1
+                        TASK(MODE(READ(A1[0]) READWRITE(A2[0]) CONSTREFERENCE(F, TRSMParH)),
+                             ftrsm (F, FFLAS::FflasRight, Uplo, FFLAS::FflasNoTrans, Diag, N2, N1,
+                                    F.mOne, A1, lda, A2, lda, TRSMParH));
+                        TASK(MODE(READWRITE(A3[0]) CONSTREFERENCE(F, RecParH1)),
+                             ftrtri (F, Uplo, Diag, N2, A3, lda, RecParH1, threshold));
+                        CHECK_DEPENDENCIES;
+                        // A2 <- A3^-1 A2 and A1 <- A1^-1
+                        TASK(MODE(READ(A3[0]) READWRITE(A2[0]) CONSTREFERENCE(F, RecParH1)),
+                             ftrmm (F, FFLAS::FflasLeft, Uplo, FFLAS::FflasNoTrans, Diag, N2, N1,
+                                    F.one, A3, lda, A2, lda, RecParH1));
+                        TASK(MODE(READWRITE(A1[0]) CONSTREFERENCE(F, RecParH2)),
+                             ftrtri (F, Uplo, Diag, N1, A1, lda, RecParH2, threshold));
+                       );
+        }
+    }
+
+    template<class Field>
+    inline void
+    ftrtrm (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_DIAG diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Sequential&, const size_t)
+    {
+        ftrtrm (F, side, diag, N, A, lda);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void
+    ftrtrm (const Field& F, const FFLAS::FFLAS_SIDE side, const FFLAS::FFLAS_DIAG diag,
+            const size_t N, typename Field::Element_ptr A, const size_t lda,
+            const FFLAS::ParSeqHelper::Parallel<Cut,Param>& PSH, const size_t threshold)
+    {
+        const size_t nt = PSH.numthreads();
+        if (N <= std::max (threshold, size_t(1)) || nt <= 1){
+            ftrtrm (F, side, diag, N, A, lda);
+            return;
+        }
+        size_t N1 = N/2;
+        size_t N2 = N-N1;
+        typename Field::Element_ptr A1 = A;
+        typename Field::Element_ptr A2 = A + N1;
+        typename Field::Element_ptr A3 = A + N1*lda;
+        typename Field::Element_ptr A4 = A + N1*(lda+1);
+        const FFLAS::FFLAS_DIAG oppDiag = (diag == FFLAS::FflasUnit) ? FFLAS::FflasNonUnit : FFLAS::FflasUnit;
+
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH (std::max(nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::Threads> RecParH2 (std::max(nt-nt/2,(size_t)1));
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+                                      FFLAS::StrategyParameter::TwoDAdaptive> MMParH (std::max(nt-nt/2,(size_t)1));
+
+        // The product of the off-diagonal blocks is computed in a temporary, concurrently with
+        // the recursive call on the diagonal block it is added to
+        if (side == FFLAS::FflasLeft){
+            typename Field::Element_ptr T = FFLAS::fflas_new (F, N1, N1);
+            SYNCH_GROUP(
+                        // A1 <- U1 L1 and T <- U2 L2
+                        TASK(MODE(READWRITE(A1[0]) CONSTREFERENCE(F, RecParH)),
+                             ftrtrm (F, side, diag, N1, A1, lda, RecParH, threshold));
+                        TASK(MODE(READ(A2[0], A3[0]) WRITE(T[0]) CONSTREFERENCE(F, MMParH)),
+                             FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, N1, N1, N2, F.one,
+                                           A2, lda, A3, lda, F.zero, T, N1, MMParH));
+                        CHECK_DEPENDENCIES;
+                        // A1 <- A1 + T, A2 <- U2 L3 and A3 <- U3 L2
+                        TASK(MODE(READ(T[0]) READWRITE(A1[0]) CONSTREFERENCE(F)),
+                             FFLAS::faddin (F, N1, N1, T, N1, A1, lda));
+                        TASK(MODE(READ(A4[0]) READWRITE(A2[0]) CONSTREFERENCE(F, RecParH)),
+                             FFLAS::ftrmm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, oppDiag,
+                                           N1, N2, F.one, A4, lda, A2, lda, RecParH));
+                        TASK(MODE(READ(A4[0]) READWRITE(A3[0]) CONSTREFERENCE(F, RecParH)),
+                             FFLAS::ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, diag,
+                                           N2, N1, F.one, A4, lda, A3, lda, RecParH));
+                        CHECK_DEPENDENCIES;
+                        // A4 <- U3 L3
+                        ftrtrm (F, side, diag, N2, A4, lda, RecParH2, threshold);
+                       );
+            FFLAS::fflas_delete (T);
+        } else { // side = FflasRight
+            typename Field::Element_ptr T = FFLAS::fflas_new (F, N2, N2);
+            SYNCH_GROUP(
+                        // A4 <- L3 U3 and T <- L2 U2
+                        TASK(MODE(READWRITE(A4[0]) CONSTREFERENCE(F, RecParH)),
+                             ftrtrm (F, side, diag, N2, A4, lda, RecParH, threshold));
+                        TASK(MODE(READ(A2[0], A3[0]) WRITE(T[0]) CONSTREFERENCE(F, MMParH)),
+                             FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, N2, N2, N1, F.one,
+                                           A3, lda, A2, lda, F.zero, T, N2, MMParH));
+                        CHECK_DEPENDENCIES;
+                        // A4 <- A4 + T, A2 <- L1 U2 and A3 <- L2 U1
+                        TASK(MODE(READ(T[0]) READWRITE(A4[0]) CONSTREFERENCE(F)),
+                             FFLAS::faddin (F, N2, N2, T, N2, A4, lda));
+                        TASK(MODE(READ(A1[0]) READWRITE(A2[0]) CONSTREFERENCE(F, RecParH)),
+                             FFLAS::ftrmm (F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, oppDiag,
+                                           N1, N2, F.one, A1, lda, A2, lda, RecParH));
+                        TASK(MODE(READ(A1[0]) READWRITE(A3[0]) CONSTREFERENCE(F, RecParH)),
+                             FFLAS::ftrmm (F, FFLAS::FflasRight, FFLAS::FflasUpper, FFLAS::FflasNoTrans, diag,
+                                           N2, N1, F.one, A1, lda, A3, lda, RecParH));
+                        CHECK_DEPENDENCIES;
+                        // A1 <- L1 U1
+                        ftrtrm (F, side, diag, N1, A1, lda, RecParH2, threshold);
+                       );
+            FFLAS::fflas_delete (T);
+        }
+    }
+
+    template<class Field, class PSHelper>
+    void trinv_left( const Field& F, const size_t N, typename Field::ConstElement_ptr L, const size_t ldl,
+                     typename Field::Element_ptr X, const size_t ldx, const PSHelper& psH)
+    {
+        FFLAS::fassign(F,N,N,L,ldl,X,ldx);
+        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasUnit, N, X, ldx, psH);
+    }
+
 } // FFPACK
 
 #endif // __FFLASFFPACK_ffpack_ftrtr_INL
@@ -0,0 +1,365 @@
+/* ffpack/ffpack_gf2.inl
+ * Copyright (C) 2019 FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_ffpack_gf2_INL
+#define __FFLASFFPACK_ffpack_gf2_INL
+
+#include <vector>
+#include <algorithm>
+
+namespace FFPACK {
+
+    namespace Protected {
+
+        typedef FFLAS::GF2Matrix::word gf2_word;
+
+        // The bits of the row r at the columns c[0..kb-1], kb <= 64
+        inline gf2_word gf2_gather (const gf2_word * r, const size_t * c, const size_t kb)
+        {
+            gf2_word s = 0;
+            for (size_t t = 0; t < kb; ++t)
+                s |= ((r[c[t]/FFLAS::GF2Matrix::wordsize] >> (c[t]%FFLAS::GF2Matrix::wordsize)) & 1) << t;
+            return s;
+        }
+
+        /* Reduces the kb <= 8 rows E[0..kb-1] of nw words, with E[t] having a one at the column c[t]
+         * and zeros at the columns c[0..t-1], so that E[t] is zero at all other columns c[u].
+         * Then fills the table T of their 2^kb sums, and Lambda[s], the coordinates of T[s] in the
+         * basis of the input rows E.
+         */
+        inline void gf2_reduced_combinations (std::vector<gf2_word>& E, const size_t * c, const size_t kb,
+                                              const size_t nw, std::vector<gf2_word>& T,
+                                              std::vector<unsigned char>& Lambda)
+        {
+            unsigned char Tr[8];
+            for (size_t t = 0; t < kb; ++t) Tr[t] = (unsigned char)(1u << t);
+            for (size_t t = kb; t-- > 0; )
+                for (size_t u = t+1; u < kb; ++u)
+                    if ((E[t*nw+c[u]/FFLAS::GF2Matrix::wordsize] >> (c[u]%FFLAS::GF2Matrix::wordsize)) & 1){
+                        FFLAS::Protected::gf2_addin (E.data()+t*nw, E.data()+u*nw, nw);
+                        Tr[t] ^= Tr[u];
+                    }
+            const size_t ns = size_t(1) << kb;
+            T.resize (ns*nw);
+            Lambda.resize (ns);
+            std::fill (T.begin(), T.begin()+nw, 0);
+            Lambda[0] = 0;
+            for (size_t s = 1; s < ns; ++s){
+                const size_t t = ctz (uint64_t(s));
+                FFLAS::Protected::gf2_add (T.data()+s*nw, T.data()+(s & (s-1))*nw, E.data()+t*nw, nw);
+                Lambda[s] = Lambda[s & (s-1)] ^ Tr[t];
+            }
+        }
+
+        /* A group of 8 pivot rows, from the word w0 on, with the table T of their combinations and
+         * their coordinates Lambda, as given by gf2_reduced_combinations
+         */
+        struct gf2_pivot_group {
+            size_t w0, gw;
+            std::vector<size_t> c;
+            std::vector<gf2_word> E, T;
+            std::vector<unsigned char> Lambda;
+        };
+
+        /* Reduces the row a by the group G, whose pivots are the pivots k0..k0+7, and records the
+         * coefficients in the row lam of Lam if not null
+         */
+        inline void gf2_reduce (gf2_word * a, const gf2_pivot_group& G, gf2_word * lam, const size_t k0)
+        {
+            const unsigned s = unsigned (gf2_gather (a, G.c.data(), 8));
+            if (!s) return;
+            FFLAS::Protected::gf2_addin (a+G.w0, G.T.data()+s*G.gw, G.gw);
+            // k0 is a multiple of 8: the coefficients fill a byte of the row of Lam
+            if (lam) lam[k0/FFLAS::GF2Matrix::wordsize] |= gf2_word (G.Lambda[s]) << (k0%FFLAS::GF2Matrix::wordsize);
+        }
+
+        /* Reduces the rows i0..m-1 of A by the ng <= 8 groups G, whose pivots are the pivots
+         * k0..k0+8*ng-1, k0 being a multiple of 64, as in the M4RI method of the Four Russians.
+         * The indices of the table entries of all groups in the reduction of a row are first
+         * computed from the bits of the row at the 8*ng pivot columns only. The rows are then
+         * updated by slices of gf2_table_words words, each slice of a row receiving the entries of
+         * the ng tables in a single pass, so that the slices of the tables stay in L2.
+         */
+        inline void gf2_reduce_rows (FFLAS::GF2Matrix& A, const size_t i0,
+                                     const std::vector<gf2_pivot_group>& G, const size_t ng,
+                                     FFLAS::GF2Matrix * Lam, const size_t k0)
+        {
+            const size_t m = A.rowdim(), nw = A.stride(), ws = FFLAS::GF2Matrix::wordsize;
+            if (i0 >= m || !ng) return;
+            // Pc[q*256+s]: the bits of the entry s of the table of the group q at all pivot columns
+            std::vector<size_t> c;
+            for (size_t q = 0; q < ng; ++q) c.insert (c.end(), G[q].c.begin(), G[q].c.end());
+            std::vector<gf2_word> Pc (ng*256);
+            for (size_t q = 0; q < ng; ++q){
+                // the table is linear in s: only the entries of the 8 pivot rows are gathered
+                gf2_word e[8];
+                for (size_t t = 0; t < 8; ++t){
+                    const gf2_word * r = G[q].T.data() + (size_t(1) << t)*G[q].gw - G[q].w0;
+                    e[t] = 0;
+                    // the pivot rows of the group are zero before the word w0
+                    for (size_t u = 0; u < c.size(); ++u)
+                        if (c[u]/ws >= G[q].w0) e[t] |= ((r[c[u]/ws] >> (c[u]%ws)) & 1) << u;
+                }
+                Pc[q*256] = 0;
+                for (size_t s = 1; s < 256; ++s)
+                    Pc[q*256+s] = Pc[q*256+(s & (s-1))] ^ e[ctz (uint64_t(s))];
+            }
+            std::vector<unsigned char> S ((m-i0)*ng);
+            for (size_t j = i0; j < m; ++j){
+                gf2_word v = gf2_gather (A.row (j), c.data(), c.size());
+                for (size_t q = 0; q < ng; ++q){
+                    const unsigned s = (v >> (8*q)) & 0xFF;
+                    S[(j-i0)*ng+q] = (unsigned char) s;
+                    v ^= Pc[q*256+s];
+                    if (Lam && s) Lam->row (j)[k0/ws] |= gf2_word (G[q].Lambda[s]) << (8*q);
+                }
+            }
+            size_t w0 = nw;
+            for (size_t q = 0; q < ng; ++q) w0 = std::min (w0, G[q].w0);
+            // the groups starting within a slice are added separately, the others through their
+            // entry 0, which is zero
+            const std::vector<gf2_word> zero (FFLAS::Protected::gf2_table_words, 0);
+            const gf2_word * Ts[8];
+            for (size_t x = w0; x < nw; x += FFLAS::Protected::gf2_table_words){
+                const size_t y = std::min (nw, x+FFLAS::Protected::gf2_table_words);
+                for (size_t j = i0; j < m; ++j){
+                    gf2_word * b = A.row (j);
+                    const unsigned char * sj = S.data() + (j-i0)*ng;
+                    for (size_t q = 0; q < ng; ++q){
+                        const gf2_word * e = G[q].T.data() + sj[q]*G[q].gw;
+                        if (G[q].w0 <= x)
+                            Ts[q] = e + (x-G[q].w0);
+                        else {
+                            Ts[q] = zero.data();
+                            if (G[q].w0 < y && sj[q]) FFLAS::Protected::gf2_addin (b+G[q].w0, e, y-G[q].w0);
+                        }
+                    }
+                    FFLAS::Protected::gf2_addin_sum (b+x, Ts, ng, y-x);
+                }
+            }
+        }
+
+        /* Gaussian elimination of the rows of A in increasing order: each row is reduced by the
+         * previous pivot rows at their pivot columns, and if nonzero, it becomes the pivot row of
+         * its first nonzero column. This reveals the rank profile matrix, whose nonzero entries are
+         * (rows[k], cols[k]). The rows of A are left reduced, the pivot rows being the rows of U.
+         * If Lam is given, Lam(i,k) receives the coefficient of the k-th pivot row in the
+         * reduction of the row i.
+         * Every time 8 pivots are found, the table of their combinations is formed, and the next
+         * rows are reduced by the group at once, by one addition from the table. Every time 64
+         * pivots are found, all the remaining rows are reduced by the 8 groups in one pass, as in
+         * the M4RI method of the Four Russians.
+         */
+        inline size_t gf2_eliminate (FFLAS::GF2Matrix& A, std::vector<size_t>& rows, std::vector<size_t>& cols,
+                                     FFLAS::GF2Matrix * Lam)
+        {
+            const size_t m = A.rowdim(), n = A.coldim(), nw = A.stride();
+            const size_t ws = FFLAS::GF2Matrix::wordsize;
+            rows.clear();
+            cols.clear();
+            size_t g0 = 0; // first pivot of the current group
+            size_t k0 = 0; // first pivot of the groups not yet applied to the remaining rows
+            std::vector<gf2_pivot_group> G (8);
+            size_t ng = 0;
+            for (size_t i = 0; i < m; ++i){
+                gf2_word * a = A.row (i);
+                for (size_t q = 0; q < ng; ++q)
+                    gf2_reduce (a, G[q], Lam ? Lam->row (i) : nullptr, k0+8*q);
+                for (size_t k = g0; k < rows.size(); ++k)
+                    if ((a[cols[k]/ws] >> (cols[k]%ws)) & 1){
+                        // the pivot row is zero before its pivot
+                        const size_t w0 = cols[k]/ws;
+                        FFLAS::Protected::gf2_addin (a+w0, A.row (rows[k])+w0, nw-w0);
+                        if (Lam) Lam->set (i, k, true);
+                    }
+                size_t w = 0;
+                while (w < nw && !a[w]) ++w;
+                if (w == nw) continue;
+                rows.push_back (i);
+                cols.push_back (w*ws + ctz (uint64_t(a[w])));
+                if (!Lam && rows.size() == std::min (m, n)) break;
+                if (rows.size() - g0 < 8 || i+1 == m) continue;
+
+                // the pivot rows of the group are zero before the word w0
+                gf2_pivot_group& H = G[ng++];
+                H.c.assign (cols.begin()+g0, cols.begin()+g0+8);
+                H.w0 = *std::min_element (H.c.begin(), H.c.end()) / ws;
+                H.gw = nw - H.w0;
+                H.E.resize (8*H.gw);
+                for (size_t t = 0; t < 8; ++t)
+                    std::copy (A.row (rows[g0+t])+H.w0, A.row (rows[g0+t])+nw, H.E.begin()+t*H.gw);
+                std::vector<size_t> cg (H.c);
+                for (auto& x : cg) x -= H.w0*ws;
+                gf2_reduced_combinations (H.E, cg.data(), 8, H.gw, H.T, H.Lambda);
+                g0 = rows.size();
+                if (ng < 8) continue;
+                gf2_reduce_rows (A, i+1, G, ng, Lam, k0);
+                ng = 0;
+                k0 = g0;
+            }
+            return rows.size();
+        }
+
+        // Positions of the pivots in the order of their columns
+        inline std::vector<size_t> gf2_sorted_pivots (const std::vector<size_t>& cols)
+        {
+            std::vector<size_t> order (cols.size());
+            for (size_t k = 0; k < order.size(); ++k) order[k] = k;
+            std::sort (order.begin(), order.end(), [&cols](size_t a, size_t b){ return cols[a] < cols[b]; });
+            return order;
+        }
+
+        // A <- its row echelon form, reduced if reduced is true; colProfile receives its column rank profile
+        inline size_t gf2_echelon (FFLAS::GF2Matrix& A, size_t * colProfile, const bool reduced)
+        {
+            const size_t ws = FFLAS::GF2Matrix::wordsize;
+            std::vector<size_t> rows, cols;
+            const size_t R = gf2_eliminate (A, rows, cols, nullptr);
+            const std::vector<size_t> order = gf2_sorted_pivots (cols);
+            FFLAS::GF2Matrix B (A.rowdim(), A.coldim());
+            std::vector<size_t> c (R);
+            for (size_t t = 0; t < R; ++t){
+                std::copy (A.row (rows[order[t]]), A.row (rows[order[t]])+A.stride(), B.row (t));
+                c[t] = cols[order[t]];
+            }
+            if (reduced){
+                // the groups of 8 pivots, from the last one, are eliminated from the rows above them
+                std::vector<gf2_word> E, T;
+                std::vector<unsigned char> Lambda;
+                for (size_t g0 = (R/8)*8 + 8; g0 > 0; ){
+                    g0 -= 8;
+                    if (g0 >= R) continue;
+                    const size_t kb = std::min (size_t(8), R-g0);
+                    const size_t w0 = c[g0] / ws;
+                    const size_t gw = B.stride() - w0;
+                    E.resize (kb*gw);
+                    for (size_t t = 0; t < kb; ++t)
+                        std::copy (B.row (g0+t)+w0, B.row (g0+t)+B.stride(), E.begin()+t*gw);
+                    std::vector<size_t> cg (c.begin()+g0, c.begin()+g0+kb);
+                    for (auto& x : cg) x -= w0*ws;
+                    gf2_reduced_combinations (E, cg.data(), kb, gw, T, Lambda);
+                    for (size_t t = 0; t < kb; ++t)
+                        std::copy (E.begin()+t*gw, E.begin()+(t+1)*gw, B.row (g0+t)+w0);
+                    for (size_t i = 0; i < g0; ++i){
+                        const unsigned s = unsigned (gf2_gather (B.row (i), c.data()+g0, kb));
+                        if (s) FFLAS::Protected::gf2_addin (B.row (i)+w0, T.data()+s*gw, gw);
+                    }
+                }
+            }
+            std::swap (A, B);
+            if (colProfile) std::copy (c.begin(), c.end(), colProfile);
+            return R;
+        }
+
+        template<class Field>
+        inline size_t
+        PLUQ_gf2 (const Field& F, const size_t M, const size_t N,
+                  typename Field::Element_ptr A, const size_t lda, size_t * P, size_t * Q)
+        {
+            FFLAS::GF2Matrix B (M, N);
+            B.setMatrix (F, A, lda);
+            const size_t R = FFPACK::PLUQ (B, P, Q);
+            B.getMatrix (F, A, lda);
+            return R;
+        }
+
+        template<class Field>
+        inline size_t
+        Rank_gf2 (const Field& F, const size_t M, const size_t N,
+                  typename Field::ConstElement_ptr A, const size_t lda)
+        {
+            FFLAS::GF2Matrix B (M, N);
+            B.setMatrix (F, A, lda);
+            return FFPACK::Rank (B);
+        }
+
+    } // Protected
+
+    inline size_t
+    PLUQ (FFLAS::GF2Matrix& A, size_t * P, size_t * Q)
+    {
+        const size_t M = A.rowdim(), N = A.coldim();
+        const size_t ws = FFLAS::GF2Matrix::wordsize;
+        std::vector<size_t> rows, cols;
+        FFLAS::GF2Matrix Lam (M, std::min (M, N));
+        const size_t R = Protected::gf2_eliminate (A, rows, cols, &Lam);
+
+        // the pivot rows come first, in their order, then the other rows in increasing order
+        std::vector<size_t> MathP (M, M);
+        for (size_t k = 0; k < R; ++k) MathP[k] = rows[k];
+        for (size_t i = 0, t = R, k = 0; i < M; ++i)
+            if (k < R && rows[k] == i) ++k;
+            else MathP[t++] = i;
+        // the pivot columns are sent first, in their order, then the others in increasing order:
+        // the column j goes to the position posQ[j], and MathQ is the inverse of posQ
+        std::vector<size_t> posQ (N, N), MathQ (N);
+        for (size_t k = 0; k < R; ++k) posQ[cols[k]] = k;
+        for (size_t j = 0, t = R; j < N; ++j)
+            if (posQ[j] == N) posQ[j] = t++;
+        for (size_t j = 0; j < N; ++j) MathQ[posQ[j]] = j;
+
+        // the row t of L\U is the row MathP[t] of Lam, followed for t < R by the pivot row t,
+        // whose columns are permuted by Q
+        FFLAS::GF2Matrix C (M, N);
+        for (size_t t = 0; t < M; ++t){
+            const Protected::gf2_word * l = Lam.row (MathP[t]);
+            Protected::gf2_word * r = C.row (t);
+            std::copy (l, l+Lam.stride(), r);
+            if (t >= R) continue;
+            const Protected::gf2_word * u = A.row (MathP[t]);
+            for (size_t w = 0; w < A.stride(); ++w)
+                for (Protected::gf2_word x = u[w]; x; x &= x-1){
+                    const size_t j = posQ[w*ws + ctz (uint64_t(x))];
+                    r[j/ws] |= Protected::gf2_word(1) << (j%ws);
+                }
+        }
+        std::swap (A, C);
+        MathPerm2LAPACKPerm (P, MathP.data(), M);
+        MathPerm2LAPACKPerm (Q, MathQ.data(), N);
+        return R;
+    }
+
+    inline size_t
+    Rank (FFLAS::GF2Matrix& A)
+    {
+        std::vector<size_t> rows, cols;
+        return Protected::gf2_eliminate (A, rows, cols, nullptr);
+    }
+
+    inline size_t
+    RowEchelonForm (FFLAS::GF2Matrix& A, size_t * colProfile)
+    {
+        return Protected::gf2_echelon (A, colProfile, false);
+    }
+
+    inline size_t
+    ReducedRowEchelonForm (FFLAS::GF2Matrix& A, size_t * colProfile)
+    {
+        return Protected::gf2_echelon (A, colProfile, true);
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_ffpack_gf2_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -56,6 +56,54 @@ namespace FFPACK {
         return A;
     }
 
+    template <class Field>
+    typename Field::Element_ptr
+    pInvert (const Field& F, const size_t M,
+             typename Field::Element_ptr A, const size_t lda,
+             int& nullity, size_t numthreads)
+    {
+        PAR_BLOCK{
+            size_t nt = numthreads ? numthreads : NUM_THREADS;
+            FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::Threads> parH(nt);
+            Invert (F, M, A, lda, nullity, parH);
+        }
+        return A;
+    }
+
+    template <class Field, class PSHelper>
+    typename Field::Element_ptr
+    Invert (const Field& F, const size_t M,
+            typename Field::Element_ptr A, const size_t lda,
+            int& nullity, const PSHelper& psH)
+    {
+        FFLASFFPACK_check(lda >= M);
+
+        Checker_invert<Field> checker(F,M,A,lda);
+
+        if (M == 0) {
+            nullity = 0 ;
+            return NULL ;
+        }
+        size_t * P = FFLAS::fflas_new<size_t>(M);
+        size_t * Q = FFLAS::fflas_new<size_t>(M);
+        size_t R =  ReducedRowEchelonForm (F, M, M, A, lda, P, Q, true, FfpackTileRecursive, psH);
+        nullity = (int)(M - R);
+
+        // A^-1 = LPerm V1 P, as in getReducedEchelonTransform
+        size_t * LPerm = FFLAS::fflas_new<size_t>(R);
+        PLUQtoEchelonPermutation (M, R, Q, LPerm);
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                      FFLAS::StrategyParameter::Threads> PermParH (psH.numthreads());
+        applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, M, 0, M, A, lda, P, PermParH);
+        applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, M, 0, R, A, lda, LPerm, PermParH);
+        FFLAS::fflas_delete(LPerm);
+        FFLAS::fflas_delete(P);
+        FFLAS::fflas_delete(Q);
+
+        checker.check(A,nullity);
+        return A;
+    }
+
     template <class Field>
     typename Field::Element_ptr
     Invert (const Field& F, const size_t M,
@@ -47,6 +47,7 @@ namespace FFPACK {
             F.assign(minP[0],F.one);
             return minP;
         }
+        Checker_minpoly<Field,Polynomial> checker (F, N, A, lda);
         // Allocating a Krylov basis
         typename Field::Element_ptr v = FFLAS::fflas_new(F, 1, N);
         // Picking a non-zero random vector
@@ -55,6 +56,7 @@ namespace FFPACK {
         MatVecMinPoly (F, minP, N, A, lda, v, 1);
 
         FFLAS::fflas_delete(v);
+        checker.check (minP);
         return minP;
     }
 
@@ -30,11 +30,28 @@
 
 
 #include <givaro/zring.h>
+#include <vector>
+#include <numeric>
+#include <algorithm>
 
 #include "fflas-ffpack/fflas/fflas_fassign.h"
 
 #define FFLASFFPACK_PERM_BKSIZE 32
 
+// size of the column panels over which applyCycles moves rows, chosen to fit in L1
+#ifndef FFLASFFPACK_PERM_PANEL_BYTES
+#define FFLASFFPACK_PERM_PANEL_BYTES 16384
+#endif
+// size of the row panels over which applyCycles moves columns, chosen to fit in L2
+#ifndef FFLASFFPACK_PERM_ROWPANEL_BYTES
+#define FFLASFFPACK_PERM_ROWPANEL_BYTES 262144
+#endif
+// minimal number of rows of these panels: below it, the columns of wide spans are moved one
+// entry at a time, which is slower than exceeding L2
+#ifndef FFLASFFPACK_PERM_MINROWPANEL
+#define FFLASFFPACK_PERM_MINROWPANEL 4
+#endif
+
 namespace FFPACK {
     /** MonotonicApplyP
      * Apply a permutation defined by the first R entries of the vector P (the pivots).
@@ -322,6 +339,157 @@ namespace FFPACK {
         }
     }
 
+    /** Cycle decomposition of the permutation defined by the transpositions ibeg..iend-1 of P
+     * (LAPACK format), or by a Math permutation, or of their inverse if Trans==FflasTrans.
+     * As in applyP_block, the columns (Side==FflasRight) are moved by the inverse of the
+     * permutation moving the rows (Side==FflasLeft).
+     * Applying it moves the entry of index Gather[k] of the input to index k, where Gather
+     * results from applying the transpositions to the identity; each non trivial cycle
+     * (k_0 ... k_{L-1}) of Gather, with k_{l+1} = Gather[k_l], is stored contiguously.
+     */
+    class TranspositionCycles {
+    public:
+        TranspositionCycles (const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                             const size_t ibeg, const size_t iend, const size_t * P)
+        {
+            if (iend <= ibeg) return;
+            const bool forward = ((Side == FFLAS::FflasLeft) == (Trans == FFLAS::FflasNoTrans));
+            size_t lo = ibeg, hi = iend;
+            for (size_t i=ibeg; i<iend; ++i){
+                lo = std::min (lo, P[i]);
+                hi = std::max (hi, P[i]+1);
+            }
+            std::vector<size_t> gather (hi-lo);
+            std::iota (gather.begin(), gather.end(), lo);
+            if (forward){
+                for (size_t i=ibeg; i<iend; ++i)
+                    std::swap (gather[i-lo], gather[P[i]-lo]);
+            } else {
+                for (size_t i=iend; i-->ibeg; )
+                    std::swap (gather[i-lo], gather[P[i]-lo]);
+            }
+            decompose (gather, lo);
+        }
+
+        // From a Math permutation of size n, whose entries are stored as Index
+        template <class Index>
+        TranspositionCycles (const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                             const size_t n, const Index * MathP)
+        {
+            std::vector<size_t> gather (n);
+            if ((Side == FFLAS::FflasLeft) == (Trans == FFLAS::FflasNoTrans))
+                std::copy (MathP, MathP+n, gather.begin());
+            else
+                for (size_t i=0; i<n; ++i)
+                    gather[MathP[i]] = i;
+            decompose (gather, 0);
+        }
+
+        size_t nbCycles() const { return _starts.empty() ? 0 : _starts.size()-1; }
+        size_t nbMoved() const { return _cycles.size(); }
+        size_t span() const { return _span; }
+        const size_t* cycle (const size_t c) const { return _cycles.data() + _starts[c]; }
+        size_t cycleLength (const size_t c) const { return _starts[c+1] - _starts[c]; }
+
+    private:
+        size_t _span = 0; // length of the range of indices touched by the permutation
+        std::vector<size_t> _cycles;
+        std::vector<size_t> _starts;
+
+        // gather[k-lo] is the index moved to k
+        void decompose (const std::vector<size_t>& gather, const size_t lo)
+        {
+            const size_t hi = lo + gather.size();
+            _span = gather.size();
+            std::vector<bool> done (_span, false);
+            for (size_t k=lo; k<hi; ++k){
+                if (done[k-lo] || gather[k-lo] == k) continue;
+                _starts.push_back (_cycles.size());
+                size_t j = k;
+                do {
+                    _cycles.push_back (j);
+                    done[j-lo] = true;
+                    j = gather[j-lo];
+                } while (j != k);
+            }
+            _starts.push_back (_cycles.size());
+        }
+    };
+
+    /** Applies the cycles C to the rows (Side==FflasLeft) or columns (Side==FflasRight) of A,
+     * each of size M.
+     * Rows are moved by contiguous copies over column panels of FFLASFFPACK_PERM_PANEL_BYTES;
+     * columns are moved over panels of rows of A small enough to stay in L2 while all the cycles
+     * are applied, but of at least FFLASFFPACK_PERM_MINROWPANEL rows.
+     */
+    template<class Field>
+    inline void
+    applyCycles (const Field& F, const FFLAS::FFLAS_SIDE Side, const size_t M,
+                 typename Field::Element_ptr A, const size_t lda, const TranspositionCycles& C)
+    {
+        const size_t nc = C.nbCycles();
+        if (!M || !nc) return;
+        if (Side == FFLAS::FflasLeft){
+            const size_t bk = std::max (size_t(FFLASFFPACK_PERM_BKSIZE),
+                                        size_t(FFLASFFPACK_PERM_PANEL_BYTES/sizeof(typename Field::Element)));
+            typename Field::Element_ptr tmp = FFLAS::fflas_new (F, std::min (bk, M));
+            for (size_t j=0; j<M; j+=bk){
+                const size_t w = std::min (bk, M-j);
+                typename Field::Element_ptr Aj = A+j;
+                for (size_t c=0; c<nc; ++c){
+                    const size_t * cyc = C.cycle(c);
+                    const size_t L = C.cycleLength(c);
+                    FFLAS::fassign (F, w, Aj+cyc[0]*lda, 1, tmp, 1);
+                    for (size_t l=0; l+1<L; ++l)
+                        FFLAS::fassign (F, w, Aj+cyc[l+1]*lda, 1, Aj+cyc[l]*lda, 1);
+                    FFLAS::fassign (F, w, tmp, 1, Aj+cyc[L-1]*lda, 1);
+                }
+            }
+            FFLAS::fflas_delete (tmp);
+        } else {
+            const size_t bk = std::max (size_t(FFLASFFPACK_PERM_MINROWPANEL), std::min (size_t(FFLASFFPACK_PERM_BKSIZE),
+                                                                                      size_t(FFLASFFPACK_PERM_ROWPANEL_BYTES/(C.span()*sizeof(typename Field::Element)))));
+            typename Field::Element_ptr tmp = FFLAS::fflas_new (F, std::min (bk, M));
+            for (size_t i=0; i<M; i+=bk){
+                const size_t h = std::min (bk, M-i);
+                typename Field::Element_ptr Ai = A+i*lda;
+                for (size_t c=0; c<nc; ++c){
+                    const size_t * cyc = C.cycle(c);
+                    const size_t L = C.cycleLength(c);
+                    FFLAS::fassign (F, h, Ai+cyc[0], lda, tmp, 1);
+                    for (size_t l=0; l+1<L; ++l)
+                        FFLAS::fassign (F, h, Ai+cyc[l+1], lda, Ai+cyc[l], lda);
+                    FFLAS::fassign (F, h, tmp, 1, Ai+cyc[L-1], lda);
+                }
+            }
+            FFLAS::fflas_delete (tmp);
+        }
+    }
+
+    template<class Field>
+    inline void
+    applyCycles (const Field& F, const FFLAS::FFLAS_SIDE Side, const size_t M,
+                 typename Field::Element_ptr A, const size_t lda, const TranspositionCycles& C,
+                 const FFLAS::ParSeqHelper::Sequential seq)
+    {
+        applyCycles (F, Side, M, A, lda, C);
+    }
+
+    template<class Field, class Cut, class Param>
+    inline void
+    applyCycles (const Field& F, const FFLAS::FFLAS_SIDE Side, const size_t M,
+                 typename Field::Element_ptr A, const size_t lda, const TranspositionCycles& C,
+                 const FFLAS::ParSeqHelper::Parallel<Cut, Param> PSH)
+    {
+        size_t incBK = (Side == FFLAS::FflasRight)?lda:1;
+        SYNCH_GROUP(
+            FORBLOCK1D(iter, M, PSH,
+                       TASK(MODE(CONSTREFERENCE(F, A, C) READWRITE(A[iter.begin()*incBK])),
+                            applyCycles(F, Side, iter.end()-iter.begin(), A+iter.begin()*incBK, lda, C));
+                       );
+                    );
+    }
+
     template<class Field>
     inline void applyP( const Field& F,
                         const FFLAS::FFLAS_SIDE Side,
@@ -330,16 +498,17 @@ namespace FFPACK {
                         typename Field::Element_ptr A, const size_t lda, const size_t * P,
                         const FFLAS::ParSeqHelper::Sequential seq)
     {
-
-        const size_t bk = FFLASFFPACK_PERM_BKSIZE;
-        const size_t NB = M/bk;
-        const size_t last = M%bk;
-        const size_t incA = (Side == FFLAS::FflasLeft)? 1:lda;
-        const size_t inc = bk*incA;
-
-        for (size_t i = 0; i<NB; i++)
-            applyP_block (F, Side, Trans, bk, ibeg, iend, A+i*inc, lda, P);
-        applyP_block (F, Side, Trans, last, ibeg, iend, A+NB*inc, lda, P);
+        if (M <= FFLASFFPACK_PERM_BKSIZE){
+            // bytes read and written by the swaps, when no entry of P is trivial
+            FFLASFFPACK_INSTRUMENT(applyP, 0, 4.*sizeof(typename Field::Element)*double(M)*double(iend-ibeg));
+            applyP_block (F, Side, Trans, M, ibeg, iend, A, lda, P);
+            return;
+        }
+        // the cycles are computed once and every entry is moved only once
+        const TranspositionCycles C (Side, Trans, ibeg, iend, P);
+        // bytes read and written by the cycles, the temporaries of each cycle included
+        FFLASFFPACK_INSTRUMENT(applyP, 0, 2.*sizeof(typename Field::Element)*double(M)*double(C.nbMoved()+C.nbCycles()));
+        applyCycles (F, Side, M, A, lda, C);
     }
 
     template<class Field>
@@ -367,6 +536,7 @@ namespace FFPACK {
                               const size_t R3, const size_t R4,
                               const FFLAS::ParSeqHelper::Sequential seq)
     {
+        FFLASFFPACK_INSTRUMENT(MatrixApplyS, 0, 2.*sizeof(typename Field::Element)*double(width)*double(2*(M2-R1-R2)+R3+R4));
         typename Field::Element_ptr tmp = FFLAS::fflas_new (F, M2-R1-R2, width);
         doApplyS (F, A, lda, tmp, width, M2, R1, R2, R3, R4);
         FFLAS::fflas_delete (tmp);
@@ -430,6 +600,7 @@ namespace FFPACK {
                               const size_t R3, const size_t R4,
                               const FFLAS::ParSeqHelper::Sequential seq)
     {
+        FFLASFFPACK_INSTRUMENT(MatrixApplyT, 0, 2.*sizeof(typename Field::Element)*double(width)*double(2*(N2-R1)+R2+R4));
         typename Field::Element_ptr tmp = FFLAS::fflas_new (F, N2-R1, width);
         doApplyT (F, A, lda, tmp, width, N2, R1, R2, R3, R4);
         FFLAS::fflas_delete (tmp);
@@ -786,13 +957,9 @@ namespace FFPACK {
                         typename Field::Element_ptr A, const size_t lda, const size_t * P,
                         const FFLAS::ParSeqHelper::Parallel<Cut, Param> PSH)
     {
-        size_t incBK = (Side == FFLAS::FflasRight)?lda:1;
-        SYNCH_GROUP(
-            FORBLOCK1D(iter, m, PSH,
-                       TASK(MODE(CONSTREFERENCE(F, A,P) READWRITE(A[iter.begin()*incBK])),
-                            applyP(F, Side, Trans, iter.end()-iter.begin(), ibeg, iend, A+iter.begin()*incBK, lda, P));
-                       );
-                    );
+        // the cycles are shared by the tasks, each one permuting a slice of the non permuted dimension
+        const TranspositionCycles C (Side, Trans, ibeg, iend, P);
+        applyCycles (F, Side, m, A, lda, C, PSH);
     }
 
 } // FFPACK
@@ -0,0 +1,315 @@
+/* ffpack/ffpack_permutation_type.inl
+ * Copyright (C) 2019 FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_ffpack_permutation_type_INL
+#define __FFLASFFPACK_ffpack_permutation_type_INL
+
+#include <vector>
+#include <numeric>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+
+namespace FFPACK {
+
+    /** A permutation of size n, stored in LAPACK format (sequence of transpositions), in Math
+     * format (row k of PA is row MathP[k] of A), or in a compressed Math format of 32 bits
+     * indices. Each format is computed on demand from the others and cached.
+     * Compositions are kept pending until a format is requested or a matrix is permuted, in
+     * which case the product is applied in a single pass over the matrix.
+     */
+    class Permutation {
+    public:
+        /// The identity permutation of size n
+        explicit Permutation (const size_t n = 0) :
+            _n(n), _forms(0)
+        {}
+
+        /// The permutation of size n stored in P, in LAPACK format if isLAPACK, in Math format otherwise
+        Permutation (const size_t n, const size_t * P, const bool isLAPACK = true) :
+            _n(n)
+        {
+            if (isLAPACK){
+                _lapack.assign (P, P+n);
+                _forms = LAPACK;
+            } else {
+                _math.assign (P, P+n);
+                _forms = MATH;
+            }
+        }
+
+        size_t size() const { return _n; }
+
+        /// Resets to the identity permutation of size n
+        void resize (const size_t n)
+        {
+            _n = n;
+            _forms = 0;
+            _pending.clear();
+        }
+
+        bool isIdentity() const
+        {
+            if (!_forms && _pending.empty()) return true;
+            const size_t * MathP = getMath();
+            for (size_t i=0; i<_n; ++i)
+                if (MathP[i] != i) return false;
+            return true;
+        }
+
+        bool isCompressed() const { return _pending.empty() && _forms == COMPRESSED; }
+
+        /// The permutation in LAPACK format
+        const size_t * getLAPACK() const
+        {
+            flush();
+            if (!(_forms & LAPACK)){
+                _lapack.resize (_n);
+                MathPerm2LAPACKPerm (_lapack.data(), getMath(), _n);
+                _forms |= LAPACK;
+            }
+            return _lapack.data();
+        }
+
+        /// The permutation in Math format
+        const size_t * getMath() const
+        {
+            flush();
+            if (!(_forms & MATH)){
+                _math.resize (_n);
+                if (_forms & COMPRESSED)
+                    std::copy (_compressed.begin(), _compressed.end(), _math.begin());
+                else if (_forms & LAPACK)
+                    LAPACKPerm2MathPerm (_math.data(), _lapack.data(), _n);
+                else
+                    std::iota (_math.begin(), _math.end(), 0);
+                _forms |= MATH;
+            }
+            return _math.data();
+        }
+
+        /** Storage of size n, initialized to the identity, where a routine can write the
+         * permutation in LAPACK format. The other formats are invalidated.
+         */
+        size_t * writeLAPACK()
+        {
+            _pending.clear();
+            _lapack.resize (_n);
+            std::iota (_lapack.begin(), _lapack.end(), 0);
+            _forms = LAPACK;
+            return _lapack.data();
+        }
+
+        /** Keeps only the compressed format, which halves the storage of the Math format.
+         * Returns false, and leaves the permutation unchanged, if n does not fit in 32 bits.
+         */
+        bool compress()
+        {
+            if (_n > std::numeric_limits<uint32_t>::max()) return false;
+            if (isCompressed()) return true;
+            const size_t * MathP = getMath();
+            _compressed.assign (MathP, MathP+_n);
+            std::vector<size_t>().swap (_math);
+            std::vector<size_t>().swap (_lapack);
+            _forms = COMPRESSED;
+            return true;
+        }
+
+        /// this <- this x Q, evaluated lazily
+        Permutation& compose (const Permutation& Q)
+        {
+            if (Q._n != _n)
+                throw std::invalid_argument ("Permutation::compose: sizes do not match");
+            if (!Q._forms && Q._pending.empty()) return *this;
+            const size_t * MathQ = Q.getMath();
+            _pending.push_back (std::vector<size_t> (MathQ, MathQ+_n));
+            return *this;
+        }
+
+        Permutation inverse() const
+        {
+            const size_t * MathP = getMath();
+            std::vector<size_t> MathI (_n);
+            for (size_t i=0; i<_n; ++i)
+                MathI[MathP[i]] = i;
+            return Permutation (_n, MathI.data(), false);
+        }
+
+        /** Applies the permutation (or its inverse if Trans==FflasTrans) to the rows
+         * (Side==FflasLeft) or columns (Side==FflasRight) of the matrix A, with M columns or rows.
+         * A pending product is applied at once, as a single set of cycles.
+         */
+        template<class Field, class PSHelper>
+        void apply (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                    const size_t M, typename Field::Element_ptr A, const size_t lda,
+                    const PSHelper& psH) const
+        {
+            if (!_n || !M || (!_forms && _pending.empty())) return;
+            flush();
+            if (_forms & LAPACK){
+                applyP (F, Side, Trans, M, 0, _n, A, lda, _lapack.data(), psH);
+                return;
+            }
+            // the cycles are read from the compressed format if no other one is available
+            const TranspositionCycles C = (_forms == COMPRESSED) ?
+                TranspositionCycles (Side, Trans, _n, _compressed.data()) :
+                TranspositionCycles (Side, Trans, _n, getMath());
+            if (C.nbMoved())
+                applyCycles (F, Side, M, A, lda, C, psH);
+        }
+
+        template<class Field>
+        void apply (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+                    const size_t M, typename Field::Element_ptr A, const size_t lda) const
+        {
+            apply (F, Side, Trans, M, A, lda, FFLAS::ParSeqHelper::Sequential());
+        }
+
+    private:
+        enum { LAPACK = 1, MATH = 2, COMPRESSED = 4 };
+
+        size_t _n;
+        mutable unsigned _forms; // the valid formats, the identity if none
+        mutable std::vector<size_t> _lapack;
+        mutable std::vector<size_t> _math;
+        mutable std::vector<uint32_t> _compressed;
+        mutable std::vector<std::vector<size_t> > _pending; // Math formats of the pending right factors
+
+        // Evaluates the pending product in Math format (in compressed format if it was the only one)
+        void flush() const
+        {
+            if (_pending.empty()) return;
+            const bool wasCompressed = (_forms == COMPRESSED);
+            std::vector<std::vector<size_t> > factors;
+            factors.swap (_pending);
+            std::vector<size_t> G (getMath(), getMath()+_n);
+            std::vector<size_t> tmp (_n);
+            for (auto& Q : factors){
+                // (P x Q)A = P (QA): row k receives row Q[P[k]] of A
+                for (size_t k=0; k<_n; ++k)
+                    tmp[k] = Q[G[k]];
+                G.swap (tmp);
+            }
+            _math.swap (G);
+            _forms = MATH;
+            if (wasCompressed){
+                _compressed.assign (_math.begin(), _math.end());
+                std::vector<size_t>().swap (_math);
+                _forms = COMPRESSED;
+            }
+        }
+    };
+
+    template<class Field>
+    inline void
+    applyP (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+            const size_t M, typename Field::Element_ptr A, const size_t lda, const Permutation& P)
+    {
+        P.apply (F, Side, Trans, M, A, lda);
+    }
+
+    template<class Field, class PSHelper>
+    inline void
+    applyP (const Field& F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+            const size_t M, typename Field::Element_ptr A, const size_t lda, const Permutation& P,
+            const PSHelper& psH)
+    {
+        P.apply (F, Side, Trans, M, A, lda, psH);
+    }
+
+    template<class Field>
+    inline size_t
+    PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
+          const size_t M, const size_t N,
+          typename Field::Element_ptr A, const size_t lda,
+          Permutation& P, Permutation& Q)
+    {
+        P.resize (M);
+        Q.resize (N);
+        return PLUQ (F, Diag, M, N, A, lda, P.writeLAPACK(), Q.writeLAPACK());
+    }
+
+    template<class Field, class PSHelper>
+    inline size_t
+    PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
+          const size_t M, const size_t N,
+          typename Field::Element_ptr A, const size_t lda,
+          Permutation& P, Permutation& Q, const PSHelper& psH)
+    {
+        P.resize (M);
+        Q.resize (N);
+        return PLUQ (F, Diag, M, N, A, lda, P.writeLAPACK(), Q.writeLAPACK(), psH);
+    }
+
+    template <class Field>
+    inline size_t
+    RowEchelonForm (const Field& F, const size_t M, const size_t N,
+                    typename Field::Element_ptr A, const size_t lda,
+                    Permutation& P, Permutation& Qt, const bool transform,
+                    const FFPACK_LU_TAG LuTag)
+    {
+        return RowEchelonForm (F, M, N, A, lda, P, Qt, transform, LuTag, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline size_t
+    RowEchelonForm (const Field& F, const size_t M, const size_t N,
+                    typename Field::Element_ptr A, const size_t lda,
+                    Permutation& P, Permutation& Qt, const bool transform,
+                    const FFPACK_LU_TAG LuTag, const PSHelper& psH)
+    {
+        P.resize (M);
+        Qt.resize (N);
+        return RowEchelonForm (F, M, N, A, lda, P.writeLAPACK(), Qt.writeLAPACK(), transform, LuTag, psH);
+    }
+
+    template <class Field>
+    inline void
+    getEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                         const FFLAS::FFLAS_DIAG diag,
+                         const size_t M, const size_t N, const size_t R,
+                         const Permutation& P, const Permutation& Q,
+                         typename Field::ConstElement_ptr A, const size_t lda,
+                         typename Field::Element_ptr T, const size_t ldt,
+                         const FFPACK_LU_TAG LuTag)
+    {
+        getEchelonTransform (F, Uplo, diag, M, N, R, P.getLAPACK(), Q.getLAPACK(), A, lda, T, ldt, LuTag);
+    }
+
+    template <class Field>
+    inline void
+    getReducedEchelonTransform (const Field& F, const FFLAS::FFLAS_UPLO Uplo,
+                                const size_t M, const size_t N, const size_t R,
+                                const Permutation& P, const Permutation& Q,
+                                typename Field::ConstElement_ptr A, const size_t lda,
+                                typename Field::Element_ptr T, const size_t ldt,
+                                const FFPACK_LU_TAG LuTag)
+    {
+        getReducedEchelonTransform (F, Uplo, M, N, R, P.getLAPACK(), Q.getLAPACK(), A, lda, T, ldt, LuTag);
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_ffpack_permutation_type_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
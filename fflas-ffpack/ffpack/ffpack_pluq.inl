@@ -426,6 +426,64 @@ namespace FFPACK {
     }
 
 
+    namespace Protected {
+
+        template<class Field, class ModeT>
+        inline size_t
+        PLUQ_basecase_select (const Field& Fi, const FFLAS::FFLAS_DIAG Diag,
+                              const size_t M, const size_t N,
+                              typename Field::Element_ptr A, const size_t lda, size_t*P, size_t *Q,
+                              const ModeT&)
+        {
+#ifdef CROUT
+            return PLUQ_basecaseCrout(Fi,Diag,M,N,A,lda,P,Q);
+#elif defined BCV2
+            return PLUQ_basecaseV2(Fi,Diag,M,N,A,lda,P,Q);
+#elif defined BCV3
+            return PLUQ_basecaseV3(Fi,Diag,M,N,A,lda,P,Q);
+#else
+            return PLUQ_basecase(Fi,Diag,M,N,A,lda,P,Q);
+#endif
+        }
+
+        // Factors the panel A, stored over small integers, in the floating point field NewField
+        template<class NewField, class Field>
+        inline size_t
+        PLUQ_basecase_convert (const Field& Fi, const FFLAS::FFLAS_DIAG Diag,
+                               const size_t M, const size_t N,
+                               typename Field::Element_ptr A, const size_t lda, size_t*P, size_t *Q)
+        {
+            NewField G ((typename NewField::Element) Fi.characteristic());
+            typename NewField::Element_ptr Af = FFLAS::fflas_new (G, M, N);
+            FFLAS::fconvert (Fi, M, N, Af, N, A, lda);
+            FFLAS::freduce (G, M, N, Af, N);
+            size_t R = PLUQ_basecase_select (G, Diag, M, N, Af, N, P, Q, FFLAS::ModeCategories::DefaultTag());
+            FFLAS::finit (Fi, M, N, Af, N, A, lda);
+            FFLAS::fflas_delete (Af);
+            return R;
+        }
+
+        // The base case panels of fields converted to a floating point one by fgemm, such as
+        // Modular<int8_t> or Modular<int16_t>, are widened to that representation, so that
+        // the elimination does not work on the small integer type entry by entry
+        template<class Field>
+        inline size_t
+        PLUQ_basecase_select (const Field& Fi, const FFLAS::FFLAS_DIAG Diag,
+                              const size_t M, const size_t N,
+                              typename Field::Element_ptr A, const size_t lda, size_t*P, size_t *Q,
+                              const FFLAS::ModeCategories::ConvertTo<FFLAS::ElementCategories::MachineFloatTag>&)
+        {
+            if (Fi.cardinality() == 2)
+                return PLUQ_basecase_convert<Givaro::Modular<float> > (Fi, Diag, M, N, A, lda, P, Q);
+            if (Fi.cardinality() < DOUBLE_TO_FLOAT_CROSSOVER)
+                return PLUQ_basecase_convert<Givaro::ModularBalanced<float> > (Fi, Diag, M, N, A, lda, P, Q);
+            if (Fi.cardinality() < Givaro::ModularBalanced<double>::maxCardinality())
+                return PLUQ_basecase_convert<Givaro::ModularBalanced<double> > (Fi, Diag, M, N, A, lda, P, Q);
+            return PLUQ_basecase_select (Fi, Diag, M, N, A, lda, P, Q, FFLAS::ModeCategories::DefaultTag());
+        }
+
+    } // Protected
+
     template<class Field>
     inline size_t
     _PLUQ (const Field& Fi, const FFLAS::FFLAS_DIAG Diag,
@@ -477,17 +535,8 @@ namespace FFPACK {
             return 1;
         }
 #else
-        if (std::min(M,N) < BCThreshold){
-#  ifdef CROUT
-            return PLUQ_basecaseCrout(Fi,Diag,M,N,A,lda,P,Q);
-#  elif defined BCV2
-            return PLUQ_basecaseV2(Fi,Diag,M,N,A,lda,P,Q);
-#  elif defined BCV3
-            return PLUQ_basecaseV3(Fi,Diag,M,N,A,lda,P,Q);
-#  else
-            return PLUQ_basecase(Fi,Diag,M,N,A,lda,P,Q);
-#  endif
-        }
+        if (std::min(M,N) < BCThreshold)
+            return Protected::PLUQ_basecase_select (Fi, Diag, M, N, A, lda, P, Q, typename FFLAS::ModeTraits<Field>::value());
 #endif
 
         FFLAS::FFLAS_DIAG OppDiag = (Diag == FFLAS::FflasUnit)? FFLAS::FflasNonUnit : FFLAS::FflasUnit;
@@ -656,7 +705,10 @@ namespace FFPACK {
           const FFLAS::ParSeqHelper::Sequential& PSHelper, size_t BCThreshold)
     {
         Checker_PLUQ<Field> checker (Fi,M,N,A,lda);
-        size_t R = FFPACK::_PLUQ(Fi,Diag,M,N,A,lda,P,Q,BCThreshold);
+        // over GF(2), the L\U storage of the bit packed PLUQ is the same for both diagonals
+        size_t R = FFLAS::Protected::useGF2 (Fi, std::min (M,N)) ?
+            Protected::PLUQ_gf2 (Fi, M, N, A, lda, P, Q) :
+            FFPACK::_PLUQ(Fi,Diag,M,N,A,lda,P,Q,BCThreshold);
         checker.check(A,lda,Diag,R,P,Q);
         return R;
     }
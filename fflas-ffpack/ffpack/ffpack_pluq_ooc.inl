@@ -0,0 +1,408 @@
+/* ffpack/ffpack_pluq_ooc.inl
+ * Copyright (C) 2019 FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file ffpack/ffpack_pluq_ooc.inl
+ * @brief Out-of-core PLUQ decomposition of a matrix stored by column panels in a memory mapped file.
+ */
+
+#ifndef __FFLASFFPACK_ffpack_pluq_ooc_INL
+#define __FFLASFFPACK_ffpack_pluq_ooc_INL
+
+#ifdef __FFLASFFPACK_HAVE_SYS_MMAN_H
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace FFPACK {
+
+    template <class Field>
+    class TileStore {
+    public:
+        typedef typename Field::Element Element;
+        typedef typename Field::Element_ptr Element_ptr;
+        typedef typename Field::ConstElement_ptr ConstElement_ptr;
+
+        TileStore (const Field& F, const std::string& filename,
+                   const size_t M, const size_t N, const size_t panelWidth);
+        TileStore (const TileStore&) = delete;
+        TileStore& operator= (const TileStore&) = delete;
+        ~TileStore ();
+
+        size_t rowdim () const { return _m; }
+        size_t coldim () const { return _n; }
+        size_t panelWidth () const { return _b; }
+        size_t nbPanels () const { return _maps.size(); }
+        /// index of the first column of panel k
+        size_t panelBegin (const size_t k) const { return k*_b; }
+        /// number of columns, and leading dimension, of panel k
+        size_t panelCols (const size_t k) const { return std::min (_b, _n - k*_b); }
+
+        /// Maps panel k, if it is not already, and returns it
+        Element_ptr load (const size_t k);
+        /// Starts reading panel k in the background (does nothing if k >= nbPanels())
+        void prefetch (const size_t k);
+        /// Writes back panel k and releases its memory; the pointers returned by load are invalidated
+        void evict (const size_t k);
+
+        /// Copies the in-core matrix A to the store, and conversely
+        void setMatrix (ConstElement_ptr A, const size_t lda);
+        void getMatrix (Element_ptr A, const size_t lda);
+
+    private:
+        struct Mapping {
+            void * addr = nullptr;
+            size_t len = 0;
+            Element_ptr ptr = nullptr;
+        };
+
+        const Field& F;
+        const size_t _m, _n, _b;
+        const size_t _page;
+        std::vector<Mapping> _maps;
+        bool _stop;
+        int _fd;
+        std::mutex _mtx;
+        std::condition_variable _cv;
+        std::deque<size_t> _queue;
+        std::thread _worker;
+
+        Element_ptr map (const size_t k);
+        void unmap (const size_t k);
+        void work ();
+    };
+
+    template <class Field>
+    TileStore<Field>::TileStore (const Field& F_, const std::string& filename,
+                                 const size_t M, const size_t N, const size_t panelWidth) :
+        F(F_), _m(M), _n(N), _b(panelWidth ? panelWidth : 1),
+        _page ((size_t) sysconf (_SC_PAGESIZE)),
+        _maps ((N + _b - 1) / _b), _stop (false)
+    {
+        static_assert (std::is_trivially_copyable<Element>::value,
+                       "TileStore: the elements must be stored by value");
+        _fd = open (filename.c_str(), O_RDWR | O_CREAT, 0644);
+        if (_fd < 0)
+            throw std::runtime_error ("TileStore: cannot open " + filename);
+        const off_t size = (off_t) (M * N * sizeof (Element));
+        struct stat st;
+        if (fstat (_fd, &st) || (st.st_size < size && ftruncate (_fd, size))){
+            close (_fd);
+            throw std::runtime_error ("TileStore: cannot allocate " + filename);
+        }
+        // the destructor is not run if the constructor throws
+        try {
+            _worker = std::thread (&TileStore::work, this);
+        } catch (...) {
+            close (_fd);
+            throw;
+        }
+    }
+
+    template <class Field>
+    TileStore<Field>::~TileStore ()
+    {
+        {
+            std::lock_guard<std::mutex> lock (_mtx);
+            _stop = true;
+        }
+        _cv.notify_all();
+        _worker.join();
+        for (size_t k = 0; k < _maps.size(); ++k)
+            unmap (k);
+        close (_fd);
+    }
+
+    template <class Field>
+    typename TileStore<Field>::Element_ptr
+    TileStore<Field>::load (const size_t k)
+    {
+        std::lock_guard<std::mutex> lock (_mtx);
+        return map (k);
+    }
+
+    template <class Field>
+    void TileStore<Field>::prefetch (const size_t k)
+    {
+        if (k >= _maps.size()) return;
+        {
+            std::lock_guard<std::mutex> lock (_mtx);
+            map (k);
+            _queue.push_back (k);
+        }
+        _cv.notify_all();
+    }
+
+    template <class Field>
+    void TileStore<Field>::evict (const size_t k)
+    {
+        std::lock_guard<std::mutex> lock (_mtx);
+        _queue.erase (std::remove (_queue.begin(), _queue.end(), k), _queue.end());
+        unmap (k);
+    }
+
+    template <class Field>
+    void TileStore<Field>::setMatrix (ConstElement_ptr A, const size_t lda)
+    {
+        for (size_t k = 0; k < nbPanels(); ++k){
+            if (k+1 < nbPanels()) prefetch (k+1);
+            FFLAS::fassign (F, _m, panelCols (k), A + panelBegin (k), lda, load (k), panelCols (k));
+            evict (k);
+        }
+    }
+
+    template <class Field>
+    void TileStore<Field>::getMatrix (Element_ptr A, const size_t lda)
+    {
+        for (size_t k = 0; k < nbPanels(); ++k){
+            if (k+1 < nbPanels()) prefetch (k+1);
+            FFLAS::fassign (F, _m, panelCols (k), load (k), panelCols (k), A + panelBegin (k), lda);
+            evict (k);
+        }
+    }
+
+    // Maps panel k if it is not yet mapped; _mtx must be held
+    template <class Field>
+    typename TileStore<Field>::Element_ptr
+    TileStore<Field>::map (const size_t k)
+    {
+        Mapping& mp = _maps[k];
+        if (mp.ptr || !_m) return mp.ptr;
+        // mmap requires an offset aligned on a page
+        const size_t offset = _m * panelBegin (k) * sizeof (Element);
+        const size_t shift = offset % _page;
+        mp.len = _m * panelCols (k) * sizeof (Element) + shift;
+        mp.addr = mmap (nullptr, mp.len, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, (off_t) (offset - shift));
+        if (mp.addr == MAP_FAILED){
+            mp.addr = nullptr;
+            throw std::runtime_error ("TileStore: cannot map a panel");
+        }
+        mp.ptr = reinterpret_cast<Element_ptr> (static_cast<char*> (mp.addr) + shift);
+        return mp.ptr;
+    }
+
+    // Writes back panel k and releases its mapping; _mtx must be held
+    template <class Field>
+    void TileStore<Field>::unmap (const size_t k)
+    {
+        Mapping& mp = _maps[k];
+        if (!mp.ptr) return;
+        msync (mp.addr, mp.len, MS_ASYNC);
+        munmap (mp.addr, mp.len);
+        mp.addr = nullptr;
+        mp.ptr = nullptr;
+    }
+
+    // Reads the prefetched panels, one at a time, into the page cache. The reads go through the
+    // file descriptor and never through the mappings, which the caller may be writing to.
+    template <class Field>
+    void TileStore<Field>::work ()
+    {
+        std::vector<char> buf (std::max (_page, (size_t) 1 << 20));
+        std::unique_lock<std::mutex> lock (_mtx);
+        while (true){
+            _cv.wait (lock, [this]{ return _stop || !_queue.empty(); });
+            if (_stop) return;
+            const size_t k = _queue.front();
+            _queue.pop_front();
+            lock.unlock();
+            size_t offset = _m * panelBegin (k) * sizeof (Element);
+            const size_t end = offset + _m * panelCols (k) * sizeof (Element);
+            while (offset < end){
+                const ssize_t got = pread (_fd, buf.data(), std::min (buf.size(), end - offset), (off_t) offset);
+                if (got <= 0) break;
+                offset += (size_t) got;
+            }
+            lock.lock();
+        }
+    }
+
+    namespace Protected {
+
+        // Applies to the rows of A, with N columns and whose first row is the row r0, the row
+        // transpositions of the panels from first to last-1, the ones of panel j acting on the rows R[j]..M-1
+        template <class Field, class PSHelper>
+        inline void
+        applyPanelPerms (const Field& F, const size_t N, typename Field::Element_ptr A, const size_t r0,
+                         const std::vector<std::vector<size_t> >& P, const std::vector<size_t>& R,
+                         const size_t first, const size_t last, const PSHelper& psH)
+        {
+            for (size_t j = first; j < last; ++j)
+                if (!P[j].empty())
+                    applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0, P[j].size(),
+                            A + (R[j]-r0)*N, N, P[j].data(), psH);
+        }
+
+        // Updates the row permutation MathP (row i of the result is row MathP[i] of the input) so that
+        // it first applies the transpositions P, acting on the rows r.., then the former MathP.
+        // Inv is the inverse of MathP and is updated accordingly.
+        inline void
+        prependPanelPerm (std::vector<size_t>& MathP, std::vector<size_t>& Inv,
+                          const std::vector<size_t>& P, const size_t r)
+        {
+            for (size_t t = P.size(); t--; ){
+                const size_t a = r + t, b = r + P[t];
+                std::swap (MathP[Inv[a]], MathP[Inv[b]]);
+                std::swap (Inv[a], Inv[b]);
+            }
+        }
+
+    } // Protected
+
+    template <class Field, class PSHelper>
+    inline size_t
+    PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag, TileStore<Field>& A,
+          size_t * P, size_t * Q, const PSHelper& psH)
+    {
+        const size_t M = A.rowdim();
+        const size_t N = A.coldim();
+        const size_t nbP = A.nbPanels();
+        const FFLAS::FFLAS_DIAG LDiag = (Diag == FFLAS::FflasUnit) ? FFLAS::FflasNonUnit : FFLAS::FflasUnit;
+
+        // Panel j holds the pivots R[j]..R[j+1]-1, in its local columns piv[j], and the row
+        // transpositions Pk[j] of its Schur rows. Once factored, a panel is only read: its rows
+        // are left in the order of the transpositions of the panels 0..j until the final pass.
+        std::vector<size_t> R (nbP+1, 0);
+        std::vector<std::vector<size_t> > Pk (nbP), piv (nbP);
+
+        typename Field::Element_ptr L = FFLAS::fflas_new (F, M, std::min (A.panelWidth(), M));
+        std::vector<size_t> Qk (A.panelWidth());
+
+        if (nbP > 1) A.prefetch (1);
+        for (size_t k = 0; k < nbP; ++k){
+            const size_t bk = A.panelCols (k);
+            typename Field::Element_ptr Ak = A.load (k);
+            if (k) A.prefetch (0);
+            Protected::applyPanelPerms (F, bk, Ak, 0, Pk, R, 0, k, psH);
+
+            // left looking update by the previous panels, the next one being prefetched
+            for (size_t j = 0; j < k; ++j){
+                A.prefetch ((j+1 < k) ? j+1 : k+1);
+                const size_t bj = A.panelCols (j);
+                const size_t rj = piv[j].size();
+                typename Field::Element_ptr Aj = A.load (j);
+                // gathers the columns of L of the pivots of panel j, and brings their rows in the
+                // current order
+                for (size_t i = 0; i < rj; ++i)
+                    FFLAS::fassign (F, M-R[j], Aj + R[j]*bj + piv[j][i], bj, L + i, rj);
+                A.evict (j);
+                if (!rj) continue;
+                Protected::applyPanelPerms (F, rj, L, R[j], Pk, R, j+1, k, psH);
+                ftrsm (F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, LDiag, rj, bk,
+                       F.one, L, rj, Ak + R[j]*bk, bk, psH);
+                fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, M-R[j+1], bk, rj,
+                       F.mOne, L + rj*rj, rj, Ak + R[j]*bk, bk, F.one, Ak + R[j+1]*bk, bk, psH);
+            }
+
+            // in-core factorization of the Schur rows, whose columns are then put back in place
+            size_t rk = 0;
+            if (M > R[k]){
+                Pk[k].resize (M-R[k]);
+                rk = PLUQ (F, Diag, M-R[k], bk, Ak + R[k]*bk, bk, Pk[k].data(), Qk.data(), psH);
+                applyP (F, FFLAS::FflasRight, FFLAS::FflasNoTrans, M-R[k], 0, bk, Ak + R[k]*bk, bk, Qk.data(), psH);
+                // the column i of the compact storage is the column MathQ[i] of the panel
+                std::vector<size_t> MathQ (bk);
+                LAPACKPerm2MathPerm (MathQ.data(), Qk.data(), bk);
+                piv[k].assign (MathQ.begin(), MathQ.begin() + rk);
+            }
+            R[k+1] = R[k] + rk;
+            A.evict (k);
+        }
+        FFLAS::fflas_delete (L);
+
+        // brings the rows of L of every panel in the final order, from the last panel to the first:
+        // MathP accumulates the transpositions of the panels j+1.., which act on the rows R[j+1]..,
+        // and are applied at once to panel j
+        std::vector<size_t> MathP (M), Inv (M), Pj (M);
+        std::iota (MathP.begin(), MathP.end(), 0);
+        std::iota (Inv.begin(), Inv.end(), 0);
+        if (nbP) A.prefetch (nbP-1);
+        for (size_t j = nbP; j--; ){
+            if (j) A.prefetch (j-1);
+            const size_t rows = M - R[j+1];
+            if (rows && j+1 < nbP){
+                for (size_t i = 0; i < rows; ++i)
+                    MathP[R[j+1]+i] -= R[j+1];
+                MathPerm2LAPACKPerm (Pj.data(), MathP.data() + R[j+1], rows);
+                for (size_t i = 0; i < rows; ++i)
+                    MathP[R[j+1]+i] += R[j+1];
+                applyP (F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, A.panelCols (j), 0, rows,
+                        A.load (j) + R[j+1]*A.panelCols (j), A.panelCols (j), Pj.data(), psH);
+            }
+            A.evict (j);
+            Protected::prependPanelPerm (MathP, Inv, Pk[j], R[j]);
+        }
+
+        // P: product of the transpositions of all panels
+        MathPerm2LAPACKPerm (P, MathP.data(), M);
+
+        // Q: sends the pivot columns first, then the others in increasing order
+        const size_t rank = R[nbP];
+        std::vector<size_t> MathQ (N);
+        std::vector<bool> pivot (N, false);
+        size_t i = 0;
+        for (size_t j = 0; j < nbP; ++j)
+            for (auto c : piv[j]){
+                MathQ[i++] = A.panelBegin (j) + c;
+                pivot[A.panelBegin (j) + c] = true;
+            }
+        for (size_t c = 0; c < N; ++c)
+            if (!pivot[c]) MathQ[i++] = c;
+        MathPerm2LAPACKPerm (Q, MathQ.data(), N);
+        return rank;
+    }
+
+    template <class Field>
+    inline size_t
+    PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag, TileStore<Field>& A, size_t * P, size_t * Q)
+    {
+        return PLUQ (F, Diag, A, P, Q, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field>
+    inline size_t
+    Rank (const Field& F, TileStore<Field>& A)
+    {
+        std::vector<size_t> P (A.rowdim()), Q (A.coldim());
+        return PLUQ (F, FFLAS::FflasNonUnit, A, P.data(), Q.data());
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_HAVE_SYS_MMAN_H
+
+#endif // __FFLASFFPACK_ffpack_pluq_ooc_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -54,6 +54,7 @@ namespace FFPACK{
                                   size_t* &rkprofile, const FFPACK_LU_TAG LuTag, PSHelper& psH){
 
 
+        Checker_rankprofile<Field> checker (F, M, N, A, lda, false);
         size_t *P = FFLAS::fflas_new<size_t>((LuTag==FfpackSlabRecursive)?N:M);
         size_t *Q = FFLAS::fflas_new<size_t>((LuTag==FfpackSlabRecursive)?M:N);
         size_t R;
@@ -67,6 +68,10 @@ namespace FFPACK{
         rkprofile = FFLAS::fflas_new<size_t> (R);
 
         RankProfileFromLU (P, M, R, rkprofile, LuTag);
+        if (LuTag == FfpackSlabRecursive)
+            checker.check (A, lda, R, Q, P, rkprofile, LuTag);
+        else
+            checker.check (A, lda, R, P, Q, rkprofile, LuTag);
 
         FFLAS::fflas_delete (Q);
         FFLAS::fflas_delete (P);
@@ -99,6 +104,7 @@ namespace FFPACK{
                               typename Field::Element_ptr A, const size_t lda,
                               size_t* &rkprofile, const FFPACK_LU_TAG LuTag, PSHelper& psH){
 
+        Checker_rankprofile<Field> checker (F, M, N, A, lda, true);
         size_t *P = FFLAS::fflas_new<size_t>(M);
         size_t *Q = FFLAS::fflas_new<size_t>(N);
         size_t R;
@@ -111,6 +117,7 @@ namespace FFPACK{
         rkprofile = FFLAS::fflas_new<size_t> (R);
 
         RankProfileFromLU (Q, N, R, rkprofile, LuTag);
+        checker.check (A, lda, R, P, Q, rkprofile, LuTag);
 
         FFLAS::fflas_delete (P);
         FFLAS::fflas_delete (Q);
@@ -288,6 +295,17 @@ namespace FFPACK{
                                   const size_t* QtPointer,
                                   typename Field::Element_ptr X, const size_t ldx)
     {
+        return LQUPtoInverseOfFullRankMinor (F, rank, A_factors, lda, QtPointer, X, ldx, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    typename Field::Element_ptr
+    LQUPtoInverseOfFullRankMinor( const Field& F, const size_t rank,
+                                  typename Field::Element_ptr A_factors, const size_t lda,
+                                  const size_t* QtPointer,
+                                  typename Field::Element_ptr X, const size_t ldx,
+                                  const PSHelper& psH)
+    {
 
         // upper entries are okay, just need to move up bottom ones
         const size_t* srcRow = QtPointer;
@@ -301,12 +319,19 @@ namespace FFPACK{
 
         // X <- (Qt.L.Q)^(-1)
         //invL( F, rank, A_factors, lda, X, ldx);
-        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasUnit, rank, A_factors, lda);
+        ftrtri (F, FFLAS::FflasLower, FFLAS::FflasUnit, rank, A_factors, lda, psH);
         FFLAS::fassign(F,rank,rank,A_factors,lda,X,ldx);
 
         // X = U^-1.X
-        ftrsm( F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans,
-               FFLAS::FflasNonUnit, rank, rank, F.one, A_factors, lda, X, ldx);
+        if (psH.numthreads() <= 1)
+            ftrsm( F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans,
+                   FFLAS::FflasNonUnit, rank, rank, F.one, A_factors, lda, X, ldx);
+        else {
+            FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Block,
+                                          FFLAS::StrategyParameter::Threads> TRSMParH (psH.numthreads());
+            ftrsm( F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans,
+                   FFLAS::FflasNonUnit, rank, rank, F.one, A_factors, lda, X, ldx, TRSMParH);
+        }
 
         return X;
 
@@ -0,0 +1,303 @@
+/* ffpack/ffpack_sparseelim.inl
+ * Copyright (C) 2018 the FFLAS-FFPACK group
+ *
+ * Written by Clement Pernet <Clement.Pernet@imag.fr>
+ *
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file ffpack/ffpack_sparseelim.inl
+ * @brief Sparse-dense hybrid Gaussian elimination: structured Gauss with Markowitz
+ * pivoting, followed by a dense PLUQ of the Schur complement.
+ */
+
+#ifndef __FFLASFFPACK_ffpack_sparseelim_INL
+#define __FFLASFFPACK_ffpack_sparseelim_INL
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <limits>
+
+namespace FFPACK {
+
+    namespace Protected {
+
+        /// row_i <- row_i - mult * row_p, where both rows are sorted by column and row_i[c] cancels
+        template <class Field, class SparseVect>
+        inline void SparseAxpy (const Field& F, SparseVect& rowi, const typename Field::Element& mult,
+                                const SparseVect& rowp, std::vector<size_t>& colCount,
+                                std::vector<std::vector<size_t> >& colRows, const size_t i,
+                                size_t& nzCols, SparseVect& tmp)
+        {
+            tmp.clear();
+            auto a = rowi.begin(), ae = rowi.end();
+            auto b = rowp.begin(), be = rowp.end();
+            typename Field::Element e; F.init(e);
+            while (a != ae || b != be){
+                if (b == be || (a != ae && a->first < b->first)){
+                    tmp.push_back (*a); ++a;
+                } else if (a == ae || b->first < a->first){
+                    // fill-in
+                    F.mul (e, mult, b->second);
+                    F.negin (e);
+                    tmp.emplace_back (b->first, e);
+                    if (!colCount[b->first]++) ++nzCols;
+                    colRows[b->first].push_back (i);
+                    ++b;
+                } else {
+                    F.assign (e, a->second);
+                    F.maxpyin (e, mult, b->second);
+                    if (F.isZero (e)){
+                        if (!--colCount[a->first]) --nzCols;
+                    }
+                    else
+                        tmp.emplace_back (a->first, e);
+                    ++a; ++b;
+                }
+            }
+            rowi.swap (tmp);
+        }
+
+        template <class SparseVect>
+        inline typename SparseVect::const_iterator SparseFind (const SparseVect& row, const size_t j)
+        {
+            auto it = std::lower_bound (row.begin(), row.end(), j,
+                                        [](const typename SparseVect::value_type& x, const size_t c){ return x.first < c; });
+            return (it != row.end() && it->first == j) ? it : row.end();
+        }
+    } // Protected
+
+    template <class Field, class PSHelper>
+    inline size_t
+    SparsePLUQ (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A,
+                SparsePLUQFactors<Field>& LU, const PSHelper& psH,
+                const double densityThreshold)
+    {
+        typedef typename SparsePLUQFactors<Field>::SparseVect SparseVect;
+        const size_t m = A.m, n = A.n;
+        LU.rowdim = m; LU.coldim = n;
+
+        // Loading A in a row-wise dynamic structure, with column occupancy
+        std::vector<SparseVect> rows (m);
+        std::vector<size_t> colCount (n, 0);
+        std::vector<std::vector<size_t> > colRows (n);
+        uint64_t activeNnz = 0;
+        for (size_t i = 0; i < m; ++i){
+            for (index_t k = A.st[i]; k < A.st[i+1]; ++k){
+                typename Field::Element e; F.init (e);
+                F.assign (e, A.dat[k]);
+                if (F.isZero (e)) continue;
+                rows[i].emplace_back (A.col[k], e);
+            }
+            std::sort (rows[i].begin(), rows[i].end(),
+                       [](const typename SparseVect::value_type& x, const typename SparseVect::value_type& y){ return x.first < y.first; });
+            for (auto& x : rows[i]){
+                colCount[x.first]++;
+                colRows[x.first].push_back (i);
+            }
+            activeNnz += rows[i].size();
+        }
+
+        // Active rows ordered by number of non zero entries
+        std::set<std::pair<size_t,size_t> > rowQueue;
+        for (size_t i = 0; i < m; ++i)
+            rowQueue.emplace (rows[i].size(), i);
+        std::vector<bool> activeCol (n, true);
+        size_t activeRows = m;
+        // number of columns with non zero entries in the active rows
+        size_t nzCols = 0;
+        for (size_t j = 0; j < n; ++j)
+            if (colCount[j]) ++nzCols;
+        SparseVect tmp;
+        typename Field::Element inv, mult;
+        F.init (inv); F.init (mult);
+
+        while (true){
+            // Rows emptied by the elimination leave the active part
+            while (!rowQueue.empty() && rowQueue.begin()->first == 0){
+                LU.zeroRows.push_back (rowQueue.begin()->second);
+                rowQueue.erase (rowQueue.begin());
+                --activeRows;
+            }
+            if (rowQueue.empty()) break;
+            if ((double)activeNnz > densityThreshold * (double)activeRows * (double)nzCols)
+                break;
+
+            // Markowitz pivot search among the sparsest rows
+            size_t bestCost = std::numeric_limits<size_t>::max(), r = m, c = n;
+            size_t searched = 0;
+            for (auto it = rowQueue.begin(); it != rowQueue.end() && searched < __FFLASFFPACK_SPARSE_ELIM_MARKOWITZ_SEARCH; ++it, ++searched){
+                const size_t i = it->second;
+                for (auto& x : rows[i]){
+                    size_t cost = (rows[i].size()-1) * (colCount[x.first]-1);
+                    if (cost < bestCost){
+                        bestCost = cost; r = i; c = x.first;
+                    }
+                }
+                if (!bestCost) break;
+            }
+
+            // Elimination of column c with the pivot row r
+            const SparseVect& rowr = rows[r];
+            F.inv (inv, Protected::SparseFind (rowr, c)->second);
+            rowQueue.erase (std::make_pair (rowr.size(), r));
+            --activeRows;
+            SparseVect Lk;
+            std::vector<size_t> touched;
+            touched.swap (colRows[c]);
+            for (size_t i : touched){
+                if (i == r || !rowQueue.count (std::make_pair (rows[i].size(), i))) continue;
+                auto it = Protected::SparseFind (rows[i], c);
+                if (it == rows[i].end()) continue; // stale occupancy entry
+                F.mul (mult, it->second, inv);
+                Lk.emplace_back (i, mult);
+                rowQueue.erase (std::make_pair (rows[i].size(), i));
+                activeNnz -= rows[i].size();
+                Protected::SparseAxpy (F, rows[i], mult, rowr, colCount, colRows, i, nzCols, tmp);
+                activeNnz += rows[i].size();
+                rowQueue.emplace (rows[i].size(), i);
+            }
+            for (auto& x : rowr)
+                if (!--colCount[x.first]) --nzCols;
+            activeNnz -= rowr.size();
+            activeCol[c] = false;
+
+            LU.pivotRows.push_back (r);
+            LU.pivotCols.push_back (c);
+            LU.L.push_back (std::move (Lk));
+            LU.U.push_back (std::move (rows[r]));
+            rows[r].clear();
+        }
+
+        // Dense phase on the non zero part of the Schur complement
+        for (auto& x : rowQueue)
+            LU.denseRows.push_back (x.second);
+        std::sort (LU.denseRows.begin(), LU.denseRows.end());
+        std::vector<size_t> denseIndex (n, n);
+        for (size_t j = 0; j < n; ++j)
+            if (activeCol[j] && colCount[j]){
+                denseIndex[j] = LU.denseCols.size();
+                LU.denseCols.push_back (j);
+            }
+        const size_t md = LU.denseRows.size(), nd = LU.denseCols.size();
+        LU.denseRank = 0;
+        if (md && nd){
+            LU.S = FFLAS::fflas_new (F, md, nd);
+            LU.P = FFLAS::fflas_new<size_t> (md);
+            LU.Q = FFLAS::fflas_new<size_t> (nd);
+            FFLAS::fzero (F, md, nd, LU.S, nd);
+            for (size_t k = 0; k < md; ++k)
+                for (auto& x : rows[LU.denseRows[k]])
+                    F.assign (LU.S[k*nd + denseIndex[x.first]], x.second);
+            LU.denseRank = PLUQ (F, FFLAS::FflasNonUnit, md, nd, LU.S, nd, LU.P, LU.Q, psH);
+
+            size_t * MathP = FFLAS::fflas_new<size_t> (md);
+            size_t * MathQ = FFLAS::fflas_new<size_t> (nd);
+            LAPACKPerm2MathPerm (MathP, LU.P, md);
+            LAPACKPerm2MathPerm (MathQ, LU.Q, nd);
+            for (size_t k = 0; k < LU.denseRank; ++k){
+                LU.pivotRows.push_back (LU.denseRows[MathP[k]]);
+                LU.pivotCols.push_back (LU.denseCols[MathQ[k]]);
+            }
+            FFLAS::fflas_delete (MathP, MathQ);
+        }
+        LU.rank = LU.L.size() + LU.denseRank;
+        return LU.rank;
+    }
+
+    template <class Field>
+    inline size_t
+    SparsePLUQ (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A,
+                SparsePLUQFactors<Field>& LU)
+    {
+        FFLAS::ParSeqHelper::Sequential seqH;
+        return SparsePLUQ (F, A, LU, seqH);
+    }
+
+    template <class Field>
+    inline size_t
+    SparseEliminationRank (const Field& F, const FFLAS::Sparse<Field, FFLAS::SparseMatrix_t::CSR>& A)
+    {
+        SparsePLUQFactors<Field> LU;
+        return SparsePLUQ (F, A, LU);
+    }
+
+    template <class Field>
+    inline bool
+    SparseSolve (const Field& F, const SparsePLUQFactors<Field>& LU,
+                 typename Field::Element_ptr x, typename Field::ConstElement_ptr b)
+    {
+        const size_t m = LU.rowdim, n = LU.coldim;
+        const size_t steps = LU.L.size();
+        typename Field::Element_ptr w = FFLAS::fflas_new (F, m);
+        FFLAS::fassign (F, m, b, 1, w, 1);
+
+        // Forward elimination of the sparse phase
+        for (size_t k = 0; k < steps; ++k){
+            const typename Field::Element& wr = w[LU.pivotRows[k]];
+            if (F.isZero (wr)) continue;
+            for (auto& l : LU.L[k])
+                F.maxpyin (w[l.first], l.second, wr);
+        }
+        bool consistent = true;
+        for (size_t i : LU.zeroRows)
+            consistent = consistent && F.isZero (w[i]);
+
+        FFLAS::fzero (F, n, x, 1);
+        // Dense phase
+        const size_t md = LU.denseRows.size(), nd = LU.denseCols.size();
+        if (consistent && md && nd){
+            typename Field::Element_ptr bd = FFLAS::fflas_new (F, md);
+            typename Field::Element_ptr xd = FFLAS::fflas_new (F, nd);
+            for (size_t k = 0; k < md; ++k)
+                F.assign (bd[k], w[LU.denseRows[k]]);
+            int info = 0;
+            fgetrs (F, FFLAS::FflasLeft, md, nd, 1, LU.denseRank, LU.S, nd, LU.P, LU.Q, xd, 1, bd, 1, &info);
+            if (info) consistent = false;
+            for (size_t k = 0; k < nd; ++k)
+                F.assign (x[LU.denseCols[k]], xd[k]);
+            FFLAS::fflas_delete (bd, xd);
+        }
+
+        // Back substitution of the sparse phase
+        typename Field::Element s; F.init (s);
+        for (size_t k = steps; consistent && k-- > 0; ){
+            const size_t c = LU.pivotCols[k];
+            F.assign (s, w[LU.pivotRows[k]]);
+            typename Field::Element piv; F.init (piv);
+            for (auto& u : LU.U[k]){
+                if (u.first == c)
+                    F.assign (piv, u.second);
+                else
+                    F.maxpyin (s, u.second, x[u.first]);
+            }
+            F.div (x[c], s, piv);
+        }
+        FFLAS::fflas_delete (w);
+        return consistent;
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_ffpack_sparseelim_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,462 @@
+/* ffpack/ffpack_wiedemann.inl
+ * Copyright (C) 2018 the FFLAS-FFPACK group
+ *
+ * Written by Clement Pernet <Clement.Pernet@imag.fr>
+ *
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file ffpack/ffpack_wiedemann.inl
+ * @brief Black box minimal polynomial, rank and determinant of sparse matrices
+ * (Wiedemann's algorithm, with several scalar projections generated together).
+ */
+
+#ifndef __FFLASFFPACK_ffpack_wiedemann_INL
+#define __FFLASFFPACK_ffpack_wiedemann_INL
+
+#include <vector>
+#include <stdexcept>
+
+namespace FFPACK {
+
+    namespace Protected {
+
+        /** Online Berlekamp-Massey algorithm.
+         * Computes the minimal generating polynomial of a linearly recurrent scalar
+         * sequence, one term at a time, with early termination once the discrepancy
+         * has vanished for \p earlyTerm consecutive terms past twice the current
+         * linear complexity.
+         */
+        template <class Field>
+        class BerlekampMassey {
+        public:
+            typedef typename Field::Element Element;
+            typedef std::vector<Element> Poly;
+
+            BerlekampMassey (const Field& F, const size_t earlyTerm = __FFLASFFPACK_WIEDEMANN_EARLY_TERM) :
+                _F(F), _C(1,F.one), _B(1,F.one), _L(0), _m(1), _zeros(0), _earlyTerm(earlyTerm)
+            {
+                _F.init(_b); _F.assign(_b, F.one);
+            }
+
+            /// Adds the next term of the sequence. Returns true when the generator is stable.
+            bool push (const Element& a)
+            {
+                const size_t n = _seq.size();
+                _seq.push_back(a);
+                // discrepancy d = sum_{i=0}^{L} C_i a_{n-i}
+                Element d; _F.init(d); _F.assign(d, a);
+                for (size_t i = 1; i < _C.size() && i <= n; ++i)
+                    _F.axpyin (d, _C[i], _seq[n-i]);
+
+                if (_F.isZero(d)){
+                    ++_m; ++_zeros;
+                } else {
+                    _zeros = 0;
+                    Element coef; _F.init(coef);
+                    _F.div (coef, d, _b);
+                    Poly T (_C);
+                    if (_C.size() < _B.size() + _m)
+                        _C.resize (_B.size() + _m, _F.zero);
+                    for (size_t i = 0; i < _B.size(); ++i)
+                        _F.maxpyin (_C[i+_m], coef, _B[i]);
+                    if (2*_L <= n){
+                        _L = n + 1 - _L;
+                        _B.swap(T);
+                        _F.assign (_b, d);
+                        _m = 1;
+                    } else
+                        ++_m;
+                }
+                return (_zeros >= _earlyTerm) && (n+1 >= 2*_L);
+            }
+
+            size_t length () const { return _seq.size(); }
+            size_t degree () const { return _L; }
+
+            /// The generator, as the reversal of the connection polynomial: monic of degree L.
+            template <class Polynomial>
+            Polynomial& generator (Polynomial& P) const
+            {
+                P.resize (_L+1);
+                for (size_t i = 0; i <= _L; ++i)
+                    _F.assign (P[_L-i], (i < _C.size()) ? _C[i] : _F.zero);
+                return P;
+            }
+
+        private:
+            const Field& _F;
+            Poly _seq;
+            Poly _C, _B;
+            Element _b;
+            size_t _L, _m, _zeros, _earlyTerm;
+        };
+
+        /// Strips the leading zero coefficients of P
+        template <class Field, class Polynomial>
+        inline void PolyNormalize (const Field& F, Polynomial& P)
+        {
+            size_t d = P.size();
+            while (d > 1 && F.isZero(P[d-1])) --d;
+            P.resize(d);
+        }
+
+        /// R <- A mod B and Q <- A div B, for B non zero
+        template <class Field, class Polynomial>
+        inline void PolyDivRem (const Field& F, Polynomial& Q, Polynomial& R,
+                                const Polynomial& A, const Polynomial& B)
+        {
+            R = A;
+            PolyNormalize (F, R);
+            const size_t db = B.size()-1;
+            if (R.size() <= db || (R.size() == 1 && F.isZero(R[0]))){
+                Q.assign (1, F.zero);
+                return;
+            }
+            Q.assign (R.size()-db, F.zero);
+            typename Field::Element lcinv; F.init(lcinv);
+            F.inv (lcinv, B[db]);
+            for (size_t k = R.size(); k-- > db; ){
+                typename Field::Element c; F.init(c);
+                F.mul (c, R[k], lcinv);
+                F.assign (Q[k-db], c);
+                if (!F.isZero(c))
+                    for (size_t i = 0; i <= db; ++i)
+                        F.maxpyin (R[k-db+i], c, B[i]);
+            }
+            R.resize ((db > 0) ? db : 1);
+            PolyNormalize (F, R);
+        }
+
+        /// Least common multiple of two monic polynomials, made monic
+        template <class Field, class Polynomial>
+        inline Polynomial& PolyLcm (const Field& F, Polynomial& L,
+                                    const Polynomial& A, const Polynomial& B)
+        {
+            Polynomial G(A), H(B), Q, R;
+            PolyNormalize (F, G); PolyNormalize (F, H);
+            // G <- gcd (A, B)
+            while (!(H.size() == 1 && F.isZero(H[0]))){
+                PolyDivRem (F, Q, R, G, H);
+                G.swap(H);
+                H.swap(R);
+            }
+            PolyDivRem (F, Q, R, B, G);
+            // L <- A * (B / gcd(A, B))
+            L.assign (A.size()+Q.size()-1, F.zero);
+            for (size_t i = 0; i < A.size(); ++i)
+                for (size_t j = 0; j < Q.size(); ++j)
+                    F.axpyin (L[i+j], A[i], Q[j]);
+            PolyNormalize (F, L);
+            typename Field::Element lcinv; F.init(lcinv);
+            F.inv (lcinv, L.back());
+            for (auto& c : L) F.mulin (c, lcinv);
+            return L;
+        }
+
+        /// Y <- A X, with X of dimension A.n x s and Y of dimension A.m x s
+        template <class Field, class SM>
+        inline void SparseApply (const Field& F, const SM& A, const size_t s,
+                                 typename Field::ConstElement_ptr X, typename Field::Element_ptr Y,
+                                 const FFLAS::ParSeqHelper::Sequential)
+        {
+            if (s == 1)
+                FFLAS::fspmv (F, A, X, F.zero, Y);
+            else
+                FFLAS::fspmm (F, A, s, X, (int)s, F.zero, Y, (int)s);
+        }
+
+#if defined(__FFLASFFPACK_USE_OPENMP)
+        template <class Field, class SM, class Cut, class Param>
+        inline void SparseApply (const Field& F, const SM& A, const size_t s,
+                                 typename Field::ConstElement_ptr X, typename Field::Element_ptr Y,
+                                 const FFLAS::ParSeqHelper::Parallel<Cut,Param>)
+        {
+            if (s == 1)
+                FFLAS::pfspmv (F, A, X, F.zero, Y);
+            else
+                FFLAS::pfspmm (F, A, s, X, (int)s, F.zero, Y, (int)s);
+        }
+#endif
+
+        /// Scales the i-th row of the n x s matrix X by D[i]
+        template <class Field>
+        inline void DiagonalApply (const Field& F, const size_t n, const size_t s,
+                                   typename Field::ConstElement_ptr D, typename Field::Element_ptr X)
+        {
+            for (size_t i = 0; i < n; ++i)
+                FFLAS::fscalin (F, s, D[i], X+i*s, 1);
+        }
+
+        template <class Field, class RandIter>
+        inline void NonZeroRandomDiagonal (const Field& F, const size_t n,
+                                           typename Field::Element_ptr D, RandIter& G)
+        {
+            for (size_t i = 0; i < n; ++i)
+                do G.random (D[i]); while (F.isZero(D[i]));
+        }
+
+        /** Core of the Wiedemann algorithm with several scalar projections.
+         * Generates the \p s scalar sequences \f$ u_j^T B^i v_j\f$ where \p Apply computes
+         * the n x s product \f$ W \gets B V\f$, runs one Berlekamp-Massey per sequence
+         * and returns the lcm of their generators, which divides the minimal polynomial of B.
+         * This is not block Wiedemann: each sequence still needs about 2 deg(minpoly) terms, the
+         * projections only share the black box applications (one fspmm instead of s fspmv) and
+         * raise the probability that the lcm is the whole minimal polynomial.
+         */
+        template <class Field, class Polynomial, class BlackBoxApply, class RandIter>
+        Polynomial&
+        MultiProjectionWiedemann (const Field& F, Polynomial& minP, const size_t n, const size_t s,
+                                  BlackBoxApply& Apply, RandIter& G)
+        {
+            typedef typename Field::Element_ptr Element_ptr;
+            if (n == 0){
+                minP.resize(1);
+                F.assign (minP[0], F.one);
+                return minP;
+            }
+            Element_ptr U = FFLAS::fflas_new (F, n, s);
+            Element_ptr V = FFLAS::fflas_new (F, n, s);
+            Element_ptr W = FFLAS::fflas_new (F, n, s);
+            NonZeroRandomMatrix (F, n, s, U, s, G);
+            NonZeroRandomMatrix (F, n, s, V, s, G);
+
+            std::vector<BerlekampMassey<Field> > BM (s, BerlekampMassey<Field>(F));
+            std::vector<bool> done (s, false);
+            size_t remaining = s;
+            for (size_t i = 0; i < 2*n && remaining; ++i){
+                for (size_t j = 0; j < s; ++j){
+                    if (done[j]) continue;
+                    if (BM[j].push (FFLAS::fdot (F, n, U+j, s, V+j, s))){
+                        done[j] = true;
+                        --remaining;
+                    }
+                }
+                if (remaining){
+                    Apply (V, W);
+                    std::swap (V, W);
+                }
+            }
+            FFLAS::fflas_delete (U, V, W);
+
+            BM[0].generator (minP);
+            for (size_t j = 1; j < s; ++j){
+                Polynomial Pj, L;
+                BM[j].generator (Pj);
+                PolyLcm (F, L, minP, Pj);
+                minP.swap(L);
+            }
+            return minP;
+        }
+
+        /// W <- A V
+        template <class Field, class SM, class PSHelper>
+        struct SparseBlackBox {
+            const Field& F; const SM& A; const size_t s; const PSHelper& psH;
+            void operator() (typename Field::ConstElement_ptr V, typename Field::Element_ptr W)
+            {
+                SparseApply (F, A, s, V, W, psH);
+            }
+        };
+
+        /// W <- A D V
+        template <class Field, class SM, class PSHelper>
+        struct SparseDiagBlackBox {
+            const Field& F; const SM& A; const size_t s; const PSHelper& psH;
+            typename Field::ConstElement_ptr D; typename Field::Element_ptr T;
+            void operator() (typename Field::ConstElement_ptr V, typename Field::Element_ptr W)
+            {
+                FFLAS::fassign (F, A.n, s, V, s, T, s);
+                DiagonalApply (F, A.n, s, D, T);
+                SparseApply (F, A, s, T, W, psH);
+            }
+        };
+
+        /// W <- D1 A^T D2 A D1 V
+        template <class Field, class SM, class SMT, class PSHelper>
+        struct SparseSymBlackBox {
+            const Field& F; const SM& A; const SMT& At; const size_t s; const PSHelper& psH;
+            typename Field::ConstElement_ptr D1; typename Field::ConstElement_ptr D2;
+            typename Field::Element_ptr T; typename Field::Element_ptr Tm;
+            void operator() (typename Field::ConstElement_ptr V, typename Field::Element_ptr W)
+            {
+                FFLAS::fassign (F, A.n, s, V, s, T, s);
+                DiagonalApply (F, A.n, s, D1, T);
+                SparseApply (F, A, s, T, Tm, psH);
+                DiagonalApply (F, A.m, s, D2, Tm);
+                SparseApply (F, At, s, Tm, W, psH);
+                DiagonalApply (F, A.n, s, D1, W);
+            }
+        };
+    } // Protected
+
+    template <class Field, class SM, class Polynomial, class RandIter, class PSHelper>
+    inline Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, RandIter& G,
+                   const size_t nbProj, const PSHelper& psH)
+    {
+        if (A.m != A.n)
+            throw std::invalid_argument ("SparseMinPoly: the matrix is not square");
+        const size_t s = std::max (nbProj, (size_t)1);
+        Protected::SparseBlackBox<Field,SM,PSHelper> BB {F, A, s, psH};
+        return Protected::MultiProjectionWiedemann (F, minP, A.n, s, BB, G);
+    }
+
+    template <class Field, class SM, class Polynomial, class RandIter>
+    inline Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, RandIter& G,
+                   const size_t nbProj)
+    {
+        FFLAS::ParSeqHelper::Sequential seqH;
+        return SparseMinPoly (F, minP, A, G, nbProj, seqH);
+    }
+
+    template <class Field, class SM, class Polynomial>
+    inline Polynomial&
+    SparseMinPoly (const Field& F, Polynomial& minP, const SM& A, const size_t nbProj)
+    {
+        typename Field::RandIter G (F);
+        return SparseMinPoly (F, minP, A, G, nbProj);
+    }
+
+    namespace Protected {
+        /// Rank of A from the minimal polynomial of the n x n matrix D1 A^T D2 A D1
+        template <class Field, class SM, class SMT, class RandIter, class PSHelper>
+        inline size_t
+        SparseGramRank (const Field& F, const SM& A, const SMT& At, RandIter& G,
+                        const size_t s, const PSHelper& psH)
+        {
+            typename Field::Element_ptr D1 = FFLAS::fflas_new (F, A.n);
+            typename Field::Element_ptr D2 = FFLAS::fflas_new (F, A.m);
+            typename Field::Element_ptr T = FFLAS::fflas_new (F, A.n, s);
+            typename Field::Element_ptr Tm = FFLAS::fflas_new (F, A.m, s);
+            NonZeroRandomDiagonal (F, A.n, D1, G);
+            NonZeroRandomDiagonal (F, A.m, D2, G);
+
+            SparseSymBlackBox<Field,SM,SMT,PSHelper> BB {F, A, At, s, psH, D1, D2, T, Tm};
+            std::vector<typename Field::Element> minP;
+            MultiProjectionWiedemann (F, minP, A.n, s, BB, G);
+            FFLAS::fflas_delete (D1, D2, T, Tm);
+
+            // With the diagonal preconditioners, x^2 does not divide minP and deg(minP/x) = rank(A)
+            size_t val = 0;
+            while (val+1 < minP.size() && F.isZero (minP[val])) ++val;
+            return minP.size() - 1 - val;
+        }
+    } // Protected
+
+    template <class Field, class SM, class SMT, class RandIter, class PSHelper>
+    inline size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, RandIter& G,
+                const size_t nbProj, const PSHelper& psH)
+    {
+        if (At.m != A.n || At.n != A.m)
+            throw std::invalid_argument ("SparseRank: At is not the transpose of A");
+        if (!A.m || !A.n) return 0;
+        const size_t s = std::max (nbProj, (size_t)1);
+        // rank(A) = rank(A^T): the preconditioned product is formed on the smaller dimension
+        if (A.m < A.n)
+            return Protected::SparseGramRank (F, At, A, G, s, psH);
+        else
+            return Protected::SparseGramRank (F, A, At, G, s, psH);
+    }
+
+    template <class Field, class SM, class SMT, class RandIter>
+    inline size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, RandIter& G, const size_t nbProj)
+    {
+        FFLAS::ParSeqHelper::Sequential seqH;
+        return SparseRank (F, A, At, G, nbProj, seqH);
+    }
+
+    template <class Field, class SM, class SMT>
+    inline size_t
+    SparseRank (const Field& F, const SM& A, const SMT& At, const size_t nbProj)
+    {
+        typename Field::RandIter G (F);
+        return SparseRank (F, A, At, G, nbProj);
+    }
+
+    template <class Field, class SM, class RandIter, class PSHelper>
+    inline typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, RandIter& G,
+               const size_t nbProj, const PSHelper& psH, const size_t maxTrials)
+    {
+        // as in IsSingular, a non square matrix is singular
+        if (A.m != A.n)
+            return F.assign (det, F.zero);
+        const size_t n = A.n;
+        if (n == 0)
+            return F.assign (det, F.one);
+        const size_t s = std::max (nbProj, (size_t)1);
+        typename Field::Element_ptr D = FFLAS::fflas_new (F, n);
+        typename Field::Element_ptr T = FFLAS::fflas_new (F, n, s);
+        std::vector<typename Field::Element> minP;
+        bool found = false;
+        for (size_t trial = 0; trial < maxTrials && !found; ++trial){
+            // The characteristic polynomial of A D is squarefree with high probability
+            Protected::NonZeroRandomDiagonal (F, n, D, G);
+            Protected::SparseDiagBlackBox<Field,SM,PSHelper> BB {F, A, s, psH, D, T};
+            Protected::MultiProjectionWiedemann (F, minP, n, s, BB, G);
+            if (F.isZero (minP[0])){
+                // x divides minpoly(A D): A is singular
+                FFLAS::fflas_delete (D, T);
+                return F.assign (det, F.zero);
+            }
+            found = (minP.size() == n+1);
+        }
+        if (!found){
+            FFLAS::fflas_delete (D, T);
+            throw CharpolyFailed();
+        }
+        // det(A D) = (-1)^n minP(0)
+        F.assign (det, minP[0]);
+        if (n & 1) F.negin (det);
+        typename Field::Element dD; F.init(dD); F.assign (dD, F.one);
+        for (size_t i = 0; i < n; ++i)
+            F.mulin (dD, D[i]);
+        F.divin (det, dD);
+        FFLAS::fflas_delete (D, T);
+        return det;
+    }
+
+    template <class Field, class SM, class RandIter>
+    inline typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, RandIter& G,
+               const size_t nbProj)
+    {
+        FFLAS::ParSeqHelper::Sequential seqH;
+        return SparseDet (F, det, A, G, nbProj, seqH, __FFLASFFPACK_WIEDEMANN_MAX_TRIALS);
+    }
+
+    template <class Field, class SM>
+    inline typename Field::Element&
+    SparseDet (const Field& F, typename Field::Element& det, const SM& A, const size_t nbProj)
+    {
+        typename Field::RandIter G (F);
+        return SparseDet (F, det, A, G, nbProj);
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_ffpack_wiedemann_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -43,6 +43,7 @@ namespace FFPACK {
             std::cerr<<"K="<<K<<" k="<<k<<" _ldm="<<_ldm<<std::endl;
         }
         size_t mn=m*n;
+        FFLASFFPACK_INSTRUMENT(rns_init, 2.*double(mn)*double(k)*double(_size), sizeof(double)*double(mn)*double(k+_size));
         double *A_beta = FFLAS::fflas_new<double >(mn*k);
         const RecInt::ruint<K>* Aiter=A;
         // split A into A_beta according to a Kronecker transform in base 2^16
@@ -152,6 +153,7 @@ namespace FFPACK {
 
         integer hM= (_M-1)>>1;
         size_t  mn= m*n;
+        FFLASFFPACK_INSTRUMENT(rns_convert, 2.*double(mn)*double(_ldm)*double(_size), sizeof(double)*double(mn)*double(_ldm+_size));
         double *A_beta= FFLAS::fflas_new<double>(mn*_ldm);
         Givaro::Timer tfgemmc;tfgemmc.start();
         if (RNS_MAJOR==false)
@@ -176,7 +178,48 @@ namespace FFPACK {
         Givaro::Modular<RecInt::ruint<K>,RecInt::ruint<K+1> > Fp(p);
         RecInt::ruint<K>* Aiter= A;
         size_t k=_ldm;
-        if ((_ldm+3)*16 > (1<<K) || p!=0){
+        // number of 16-bit digits of a ruint<K+2>
+        constexpr size_t wdigits = size_t(1)<<(K-2);
+        if (p!=0 && _ldm+3 <= wdigits){
+            // reconstruction modulo p without Givaro::Integer: the digits of each entry are
+            // normalized into a ruint<K+2>, which holds the CRT sums (< _size._M)
+            typedef RecInt::ruint<K+2> Wide;
+            const Wide Mw(_M), hMw(hM), pw(p);
+            const RecInt::ruint<K> g(gamma);
+            const bool gzero = (gamma==0);
+            Wide w;
+            uint16_t* w_ptr = reinterpret_cast<uint16_t*>(&w);
+            for(size_t i=0;i<m;i++)
+                for (size_t j=0;j<n;j++){
+                    size_t idx=i*n+j;
+                    double x, carry=0.;
+                    for (size_t l=0;l<wdigits;l++){
+                        x = ((l<k)?A_beta[l+idx*k]:0.) + carry;
+                        carry = std::floor(x*(1./65536.));
+#ifdef __FFLASFFPACK_HAVE_LITTLE_ENDIAN
+                        w_ptr[l] = (uint16_t)(x-carry*65536.);
+#else
+                        w_ptr[l^((__RECINT_LIMB_BITS/16U)-1U)] = (uint16_t)(x-carry*65536.);
+#endif
+                    }
+                    w%=Mw;
+                    // get the correct result according to the expected sign of A
+                    const bool neg = (w>hMw);
+                    if (neg)
+                        w=Mw-w;
+                    w%=pw;
+                    RecInt::ruint<K> r(w.Low.Low);
+                    if (neg)
+                        Fp.negin(r);
+                    if (gzero)
+                        Aiter[j+i*lda]=r;
+                    else {
+                        Fp.mulin(Aiter[j+i*lda],g);
+                        Fp.addin(Aiter[j+i*lda],r);
+                    }
+                }
+        }
+        else if ((_ldm+3)*16 > (1<<K) || p!=0){
             //std::cerr<<"ERROR: RNS with recint<"<<K<<"> -> convert needs "<<(_ldm+3)*16<<"bits ...aborting"<<std::endl;
             //std::terminate();
             size_t k4=((k+3)>>2)+ (((k+3)%4==0)?0:1);
@@ -41,6 +41,7 @@ namespace FFPACK {
             std::cerr<<"with k="<<k<<" _ldm="<<_ldm<<std::endl;
         }
         const size_t mn=m*n;
+        FFLASFFPACK_INSTRUMENT(rns_init, 2.*double(mn)*double(k)*double(_size), sizeof(double)*double(mn)*double(k+_size));
         if (mn) {
         double *A_beta = FFLAS::fflas_new<double >(mn*k);
         const integer* Aiter=A;
@@ -153,6 +154,7 @@ namespace FFPACK {
             FFPACK::failure()(__func__,__FILE__,__LINE__,"rns_struct: init (too large entry)");
 
         const size_t mn=m*n;
+        FFLASFFPACK_INSTRUMENT(rns_init, 2.*double(mn)*double(k)*double(_size), sizeof(double)*double(mn)*double(k+_size));
         if (mn) {
         double *A_beta = FFLAS::fflas_new<double >(mn*k);
         const integer* Aiter=A;
@@ -224,8 +226,102 @@ namespace FFPACK {
 
     inline void rns_double::convert(size_t m, size_t n, integer gamma, integer* A, size_t lda,
                                     const double* Arns, size_t rda, bool RNS_MAJOR) const
+    {
+        convert_simd(m,n,gamma,A,lda,Arns,rda,RNS_MAJOR);
+    }
+
+    // A = gamma.A + CRT(Arns), with the digits in base 2^16 normalized by a vectorized carry propagation
+    inline void rns_double::convert_simd(size_t m, size_t n, integer gamma, integer* A, size_t lda,
+                                         const double* Arns, size_t rda, bool RNS_MAJOR) const
+    {
+        const size_t mn= m*n;
+        FFLASFFPACK_INSTRUMENT(rns_convert, 2.*double(mn)*double(_ldm)*double(_size), sizeof(double)*double(mn)*double(_ldm+_size));
+        if (!mn) return;
+        integer hM= (_M-1)>>1;
+        // room for the carries out of the _ldm digits, rounded to a whole number of limbs
+        const size_t dpl = sizeof(mp_limb_t)/2;
+        const size_t nd = ((_ldm+3+dpl-1)/dpl)*dpl;
+
+        // A_beta^T = M_beta^T x Ap: row l holds the (non normalized) l-th digit of every entry
+        double *A_beta= FFLAS::fflas_new<double>(mn*nd);
+        if (RNS_MAJOR==false) {
+#ifndef ENABLE_CHECKER_fgemm
+            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasTrans, FFLAS::FflasNoTrans, _ldm, mn, _size, 1.0 , _crt_out.data(), _ldm, Arns, rda, 0., A_beta, mn, FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive >());
+#else
+            cblas_dgemm(CblasRowMajor,CblasTrans, CblasNoTrans, (int)_ldm, (int)mn, (int)_size, 1.0 , _crt_out.data(), (int)_ldm, Arns, (int)rda, 0., A_beta,(int)mn);
+#endif
+        }
+        else {
+#ifndef ENABLE_CHECKER_fgemm
+            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasTrans, FFLAS::FflasTrans, _ldm, mn, _size, 1.0 , _crt_out.data(), _ldm, Arns, _size, 0., A_beta, mn, FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive >());
+#else
+            cblas_dgemm(CblasRowMajor,CblasTrans, CblasTrans, (int)_ldm, (int)mn, (int)_size, 1.0 , _crt_out.data(), (int)_ldm, Arns, (int)_size, 0., A_beta,(int)mn);
+#endif
+        }
+        FFLAS::fzero(Givaro::ZRing<double>(), nd-_ldm, mn, A_beta+_ldm*mn, mn);
+
+        // columns are processed by blocks that stay in cache between the carry propagation and the assembly
+        const size_t bs = 64;
+        std::vector<uint16_t> digits(nd);
+        integer res;
+        mpz_t* r0 = reinterpret_cast<mpz_t*>(&res);
+        for (size_t j0=0; j0<mn; j0+=bs){
+            const size_t j1 = std::min(j0+bs, mn);
+            size_t j=j0;
+#ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
+            using simd = Simd<double>;
+            using vect_t = typename simd::vect_t;
+            const vect_t beta = simd::set1(65536.);
+            const vect_t ibeta = simd::set1(1./65536.);
+            for (; j+simd::vect_size <= j1; j+=simd::vect_size){
+                vect_t x, carry = simd::zero();
+                for (size_t l=0; l<nd; ++l){
+                    x = simd::add(simd::loadu(A_beta+l*mn+j), carry);
+                    carry = simd::floor(simd::mul(x, ibeta));
+                    simd::storeu(A_beta+l*mn+j, simd::fnmadd(x, carry, beta));
+                }
+            }
+#endif
+            for (; j<j1; ++j){
+                double x, carry = 0.;
+                for (size_t l=0; l<nd; ++l){
+                    x = A_beta[l*mn+j] + carry;
+                    carry = std::floor(x*(1./65536.));
+                    A_beta[l*mn+j] = x - carry*65536.;
+                }
+            }
+            // every digit is now in [0,2^16): the integer is read at once from its digits
+            for (j=j0; j<j1; ++j){
+                for (size_t l=0; l<nd; ++l)
+                    digits[l] = (uint16_t) A_beta[l*mn+j];
+                mpz_import(r0[0], nd, -1, sizeof(uint16_t), 0, 0, digits.data());
+                res%=_M;
+                if (res>hM)
+                    res-=_M;
+                integer& a = A[(j/n)*lda+(j%n)];
+                if (gamma==0)
+                    a=res;
+                else
+                    if (gamma==integer(1))
+                        a+=res;
+                    else
+                        if (gamma==integer(-1))
+                            a=res-a;
+                        else{
+                            a*=gamma;
+                            a+=res;
+                        }
+            }
+        }
+        FFLAS::fflas_delete(A_beta);
+    }
+
+    // A = gamma.A + CRT(Arns), where the digits in base 2^16 are summed as four interleaved integers
+    inline void rns_double::convert_kronecker(size_t m, size_t n, integer gamma, integer* A, size_t lda,
+                                              const double* Arns, size_t rda, bool RNS_MAJOR) const
     {
         const size_t  mn= m*n;
+        FFLASFFPACK_INSTRUMENT(rns_convert, 2.*double(mn)*double(_ldm)*double(_size), sizeof(double)*double(mn)*double(_ldm+_size));
         if (mn) {
 #ifdef CHECK_RNS
         integer* Acopy=new integer[m*n];
@@ -349,6 +445,7 @@ namespace FFPACK {
                                               const double* Arns, size_t rda, bool RNS_MAJOR) const
     {
         const size_t  mn= m*n;
+        FFLASFFPACK_INSTRUMENT(rns_convert, 2.*double(mn)*double(_ldm)*double(_size), sizeof(double)*double(mn)*double(_ldm+_size));
         if (mn) {
         integer hM= (_M-1)>>1;
         double *A_beta= FFLAS::fflas_new<double>(mn*_ldm);
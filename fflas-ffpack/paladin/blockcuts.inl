@@ -41,6 +41,7 @@ namespace FFLAS {
         struct Block{};
         struct Recursive{};
         typedef Row RNSModulus;
+        struct RNSPipeline{}; // multimodular products: groups of moduli streamed through conversion, products and CRT
     }
 
     namespace StrategyParameter{
@@ -0,0 +1,709 @@
+/*
+ * Copyright (C) FFLAS-FFPACK
+ * Written by Clément Pernet
+ * This file is Free Software and part of FFLAS-FFPACK.
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/*! @file utils/bench-utils.h
+ * @ingroup benchmarks
+ * @brief Common driver of the benchmarks: warmup, repetitions until a target
+ * confidence interval, median/p95 statistics and machine readable reports.
+ *
+ * A benchmark drives its timing loop through a Benchmark object:
+ * @code
+ *   FFLAS::Benchmark bench ("fgemm", as, iter);
+ *   while (bench.next()) {
+ *       // untimed setup
+ *       bench.start(); fgemm (...); bench.stop();
+ *   }
+ *   bench.report (FFLAS::BenchFlops::fgemm (m,n,k));
+ * @endcode
+ * The text line "Time: <median> Gfops: <rate> ..." is kept for perfpublisher.sh.
+ * The driver is configured by the environment:
+ *  - FFLAS_BENCH_FORMAT  : text (default), json (one object per line) or csv,
+ *  - FFLAS_BENCH_OUTPUT  : file the json/csv records are appended to (default: stdout),
+ *  - FFLAS_BENCH_WARMUP  : number of untimed warmup repetitions (default 1),
+ *  - FFLAS_BENCH_CI      : target relative half width of the 95% confidence
+ *                          interval of the mean (default 0.05, 0 to run exactly the minimal count),
+ *  - FFLAS_BENCH_MAXREPS : maximal number of timed repetitions (default 100),
+ *  - FFLAS_BENCH_MAXTIME : time budget in seconds after which no new repetition starts (default 30).
+ * The csv records can be stored as a baseline and checked with benchmarks/bench-compare.sh.
+ *
+ * The reproducible mode is meant for measurements compared across runs or machines:
+ *  - FFLAS_BENCH_REPRODUCIBLE : 1 to annotate the unstable measurements, strict to refuse them
+ *                               (no json/csv record is written), 0 (default) to disable,
+ *  - FFLAS_BENCH_MAXCV        : maximal coefficient of variation of the repetitions (default 0.05),
+ *  - FFLAS_BENCH_MAXDRIFT     : maximal relative drift of the clock during the run (default 0.05).
+ * In this mode, the threads are pinned to the allowed cores (Linux only) until the end of the
+ * repetitions and the clock is estimated by a calibrated spin loop before and after them.
+ * A measurement is unstable when the repetitions vary too much (noisy neighbours), when the
+ * clock drifts (turbo, thermal throttling), when the host is already loaded or when the threads
+ * could not be pinned.
+ */
+
+#ifndef __FFLASFFPACK_utils_bench_utils_H
+#define __FFLASFFPACK_utils_bench_utils_H
+
+#include "fflas-ffpack/fflas-ffpack-config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "fflas-ffpack/paladin/parallel.h"
+#include "fflas-ffpack/utils/timer.h"
+#include "fflas-ffpack/utils/args-parser.h"
+
+namespace FFLAS {
+
+    /// Number of field operations of the benchmarked routines, following the
+    /// conventions of the historical Gfops figures of the benchmarks
+    namespace BenchFlops {
+        /// C <- A*B + C, A is m x k
+        inline double fgemm (size_t m, size_t n, size_t k) { return 2.*double(m)*double(n)*double(k); }
+        /// y <- A*x + y, A is m x n
+        inline double fgemv (size_t m, size_t n) { return 2.*double(m)*double(n); }
+        inline double fdot (size_t n) { return 2.*double(n); }
+        /// matrix addition of m x n matrices
+        inline double fadd (size_t m, size_t n) { return double(m)*double(n); }
+        /// solve with an m x m triangular matrix and n right hand sides
+        inline double ftrsm (size_t m, size_t n) { return double(m)*double(m)*double(n); }
+        inline double ftrsv (size_t n) { return double(n)*double(n); }
+        inline double ftrtri (size_t n) { return double(n)*double(n)*double(n)/3.; }
+        /// C <- A*A^T + C, A is n x k
+        inline double fsyrk (size_t n, size_t k) { return double(n)*double(n)*double(k); }
+        /// symmetric factorization of an n x n matrix of rank r
+        inline double fsytrf (size_t n, size_t r) {
+            const double dn=double(n), dr=double(r);
+            return dr*dr*dr/3. + dn*dn*dr - dr*dr*dn;
+        }
+        inline double fsytrf (size_t n) { return fsytrf (n,n); }
+        /// PLUQ or echelon form of an m x n matrix of rank r
+        inline double pluq (size_t m, size_t n, size_t r) {
+            const double dm=double(m), dn=double(n), dr=double(r);
+            return 2.*dm*dn*dr - (dm+dn)*dr*dr + 2.*dr*dr*dr/3.;
+        }
+        inline double inverse (size_t n) { return 2.*double(n)*double(n)*double(n); }
+        inline double charpoly (size_t n) { return 2.*double(n)*double(n)*double(n); }
+        /// solve of an m x m system with n right hand sides
+        inline double fgesv (size_t m, size_t n) { return double(m)*double(m)*(2.*double(m)/3.+2.*double(n)); }
+        /// sparse product with a matrix of nnz non zero entries and blocksize vectors
+        inline double fspmv (size_t nnz, size_t blocksize = 1) { return 2.*double(nnz)*double(blocksize); }
+    }
+
+    /// Statistics of the timed repetitions, in seconds
+    struct BenchmarkStats {
+        size_t reps = 0;
+        double min = 0., max = 0., mean = 0., median = 0., p95 = 0., stddev = 0.;
+        double ci = 0.; //!< half width of the 95% confidence interval of the mean
+    };
+
+    namespace Protected {
+
+        inline double benchEnv (const char* name, double def)
+        {
+            const char* v = std::getenv (name);
+            return (v != nullptr && *v != '\0') ? std::atof (v) : def;
+        }
+
+        inline std::string benchEnv (const char* name, const char* def)
+        {
+            const char* v = std::getenv (name);
+            return std::string ((v != nullptr && *v != '\0') ? v : def);
+        }
+
+        /// 97.5% quantile of the Student distribution with df degrees of freedom
+        inline double studentQuantile (size_t df)
+        {
+            static const double t[] = { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+            return (df == 0) ? 0. : ((df <= 30) ? t[df-1] : 1.96);
+        }
+
+        inline BenchmarkStats benchStats (std::vector<double> s)
+        {
+            BenchmarkStats st;
+            st.reps = s.size();
+            if (s.empty()) return st;
+            std::sort (s.begin(), s.end());
+            const size_t n = s.size();
+            st.min = s.front();
+            st.max = s.back();
+            st.median = (n & 1) ? s[n/2] : (s[n/2-1]+s[n/2])/2.;
+            // nearest rank percentile
+            st.p95 = s[size_t(std::ceil (0.95*double(n)))-1];
+            for (auto x : s) st.mean += x;
+            st.mean /= double(n);
+            if (n > 1) {
+                double v = 0.;
+                for (auto x : s) v += (x-st.mean)*(x-st.mean);
+                st.stddev = std::sqrt (v/double(n-1));
+                st.ci = studentQuantile (n-1) * st.stddev / std::sqrt (double(n));
+            }
+            return st;
+        }
+
+        inline std::string benchHost ()
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            char name[256];
+            if (gethostname (name, sizeof(name)) == 0) {
+                name[sizeof(name)-1] = '\0';
+                return std::string (name);
+            }
+#endif
+            return "unknown";
+        }
+
+        inline std::string benchCPU ()
+        {
+            std::ifstream cpuinfo ("/proc/cpuinfo");
+            std::string line;
+            while (std::getline (cpuinfo, line))
+                if (line.compare (0, 10, "model name") == 0) {
+                    size_t pos = line.find (':');
+                    if (pos != std::string::npos && pos+2 <= line.size())
+                        return line.substr (pos+2);
+                }
+            return "unknown";
+        }
+
+        inline std::string benchBLAS ()
+        {
+#if defined(__FFLASFFPACK_BLAS_NAME)
+            return __FFLASFFPACK_BLAS_NAME;
+#elif defined(__FFLASFFPACK_HAVE_MKL)
+            return "MKL";
+#elif defined(__FFLASFFPACK_OPENBLAS_NUM_THREADS)
+            std::ostringstream os;
+            os << "OpenBLAS (" << __FFLASFFPACK_OPENBLAS_NUM_THREADS << " threads)";
+            return os.str();
+#elif defined(__FFLASFFPACK_HAVE_CBLAS)
+            return "CBLAS";
+#else
+            return "BLAS";
+#endif
+        }
+
+        inline std::string benchCompiler ()
+        {
+#if defined(__VERSION__)
+            return __VERSION__;
+#else
+            return "unknown";
+#endif
+        }
+
+        inline std::string benchDate ()
+        {
+            char buf[32];
+            std::time_t now = std::time (nullptr);
+            std::strftime (buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime (&now));
+            return std::string (buf);
+        }
+
+        inline std::string jsonEscape (const std::string& s)
+        {
+            std::string r;
+            for (char c : s) {
+                if (c == '"' || c == '\\') { r += '\\'; r += c; }
+                else if (c == '\n') r += "\\n";
+                else if ((unsigned char)c < 0x20) r += ' ';
+                else r += c;
+            }
+            return r;
+        }
+
+        /// csv fields are never quoted: separators are replaced by blanks
+        inline std::string csvEscape (const std::string& s)
+        {
+            std::string r (s);
+            for (auto& c : r)
+                if (c == ',' || c == '"' || c == '\n' || c == '\r') c = ' ';
+            return r;
+        }
+
+        inline std::string trim (const std::string& s)
+        {
+            size_t b = s.find_first_not_of (' ');
+            if (b == std::string::npos) return "";
+            return s.substr (b, s.find_last_not_of (' ')-b+1);
+        }
+
+        /// Affinity masks of the threads of the runtime before benchPinThreads, indexed by thread
+        struct BenchAffinity {
+#if defined(__linux__)
+            std::vector<cpu_set_t> masks;
+            std::vector<char> saved;
+#endif
+        };
+
+        inline size_t benchThreadNum ()
+        {
+#ifdef __FFLASFFPACK_USE_OPENMP
+            return size_t (omp_get_thread_num());
+#else
+            return 0;
+#endif
+        }
+
+        /// Pins each thread of the runtime to one of the cores the process is allowed on,
+        /// after saving its previous mask in prev
+        inline bool benchPinThreads (BenchAffinity& prev)
+        {
+#if defined(__linux__)
+            cpu_set_t allowed;
+            if (sched_getaffinity (0, sizeof(allowed), &allowed) != 0)
+                return false;
+            std::vector<int> cpus;
+            for (int c = 0; c < CPU_SETSIZE; ++c)
+                if (CPU_ISSET (c, &allowed)) cpus.push_back (c);
+            if (cpus.empty())
+                return false;
+#ifdef __FFLASFFPACK_USE_OPENMP
+            const size_t nt = size_t (omp_get_max_threads());
+#else
+            const size_t nt = 1;
+#endif
+            prev.masks.assign (nt, allowed);
+            prev.saved.assign (nt, 0);
+            auto pin = [&cpus, &prev] (size_t t) {
+                if (t >= prev.masks.size())
+                    return false;
+                if (sched_getaffinity (0, sizeof(cpu_set_t), &prev.masks[t]) != 0)
+                    return false;
+                prev.saved[t] = 1;
+                cpu_set_t one;
+                CPU_ZERO (&one);
+                CPU_SET (cpus[t % cpus.size()], &one);
+                return sched_setaffinity (0, sizeof(one), &one) == 0;
+            };
+            bool ok = true;
+#ifdef __FFLASFFPACK_USE_OPENMP
+#pragma omp parallel reduction(&&:ok)
+            ok = pin (benchThreadNum());
+#else
+            ok = pin (0);
+#endif
+            return ok;
+#else
+            return false;
+#endif
+        }
+
+        /// Gives back to each thread the mask saved by benchPinThreads
+        inline void benchUnpinThreads (const BenchAffinity& prev)
+        {
+#if defined(__linux__)
+            auto unpin = [&prev] (size_t t) {
+                if (t < prev.saved.size() && prev.saved[t])
+                    sched_setaffinity (0, sizeof(cpu_set_t), &prev.masks[t]);
+            };
+#ifdef __FFLASFFPACK_USE_OPENMP
+#pragma omp parallel
+            unpin (benchThreadNum());
+#else
+            unpin (0);
+#endif
+#endif
+        }
+
+        /// Estimates the clock in GHz by a chain of dependent additions, one per cycle,
+        /// taking the fastest of a few short runs
+        inline double benchClock ()
+        {
+            const uint64_t N = uint64_t(1) << 24;
+            double best = 0.;
+            for (int run = 0; run < 5; ++run) {
+                uint64_t x = 0;
+                auto t0 = std::chrono::steady_clock::now();
+                for (uint64_t i = 0; i < N; ++i) {
+                    x += i;
+#if defined(__GNUC__)
+                    __asm__ volatile ("" : "+r" (x));
+#endif
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                volatile uint64_t sink = x; (void) sink;
+                const double t = std::chrono::duration<double> (t1 - t0).count();
+                if (t > 0.) best = std::max (best, double(N) / t / 1e9);
+            }
+            return best;
+        }
+
+        /// Number of runnable tasks of the host besides the calling one, -1 when unknown.
+        /// The minimum of a few samples is taken, to ignore the short lived tasks.
+        inline long benchBusy ()
+        {
+            long busy = -1;
+            for (int sample = 0; sample < 3; ++sample) {
+                std::ifstream f ("/proc/loadavg");
+                double load;
+                long running;
+                char slash;
+                if (!(f >> load >> load >> load >> running >> slash) || slash != '/')
+                    return -1;
+                busy = (busy < 0) ? running-1 : std::min (busy, running-1);
+                auto t0 = std::chrono::steady_clock::now();
+                while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds (5));
+            }
+            return std::max (busy, 0L);
+        }
+
+        /// Number of online cores, 0 when unknown
+        inline long benchCores ()
+        {
+#if defined(_SC_NPROCESSORS_ONLN)
+            return std::max (0L, sysconf (_SC_NPROCESSORS_ONLN));
+#else
+            return 0;
+#endif
+        }
+
+        /// State of the frequency boost: "on", "off" or "unknown"
+        inline std::string benchTurbo ()
+        {
+            int v;
+            std::ifstream intel ("/sys/devices/system/cpu/intel_pstate/no_turbo");
+            if (intel >> v) return v ? "off" : "on";
+            std::ifstream boost ("/sys/devices/system/cpu/cpufreq/boost");
+            if (boost >> v) return v ? "on" : "off";
+            return "unknown";
+        }
+    }
+
+    /// Driver of the timing loop of a benchmark
+    class Benchmark {
+    public:
+        /*! @param name      name of the benchmark in the reports
+         *  @param args      arguments of the program, written in the reports
+         *  @param minreps   minimal number of timed repetitions (usually the -i argument)
+         */
+        Benchmark (const std::string& name, Argument* args, size_t minreps = 1) :
+            _name (name), _args (args), _minreps (std::max (minreps, size_t(1))), _calls (0)
+        {
+            _warmup = size_t (Protected::benchEnv ("FFLAS_BENCH_WARMUP", 1.));
+            _target = Protected::benchEnv ("FFLAS_BENCH_CI", 0.05);
+            _maxreps = std::max (_minreps, size_t (Protected::benchEnv ("FFLAS_BENCH_MAXREPS", 100.)));
+            _maxtime = Protected::benchEnv ("FFLAS_BENCH_MAXTIME", 30.);
+            _format = Protected::benchEnv ("FFLAS_BENCH_FORMAT", "text");
+            _output = Protected::benchEnv ("FFLAS_BENCH_OUTPUT", "");
+            const std::string repro = Protected::benchEnv ("FFLAS_BENCH_REPRODUCIBLE", "0");
+            _repro = (repro == "strict") ? 2 : ((repro == "0" || repro == "no") ? 0 : 1);
+            _maxcv = Protected::benchEnv ("FFLAS_BENCH_MAXCV", 0.05);
+            _maxdrift = Protected::benchEnv ("FFLAS_BENCH_MAXDRIFT", 0.05);
+        }
+
+        /// Gives back their affinity to the threads pinned in reproducible mode
+        ~Benchmark () { release(); }
+
+        /// Caps the number of timed repetitions and the time budget, whatever
+        /// FFLAS_BENCH_MAXREPS and FFLAS_BENCH_MAXTIME are.
+        /// Must be called before the first call to next().
+        void limit (size_t maxreps, double maxtime)
+        {
+            _maxreps = std::max (_minreps, std::min (_maxreps, maxreps));
+            _maxtime = std::min (_maxtime, maxtime);
+        }
+
+        /// Switches the reproducible mode on, whatever FFLAS_BENCH_REPRODUCIBLE is.
+        /// Must be called before the first call to next().
+        void reproducible (bool strict = false) { _repro = strict ? 2 : 1; }
+
+        /// Returns true while another repetition is to be run: first the warmup ones,
+        /// then the timed ones until the confidence interval or a limit is reached
+        bool next ()
+        {
+            if (_calls == 0 && _repro && !_prepared)
+                prepare();
+            if (_calls < _warmup) {
+                ++_calls;
+                return true;
+            }
+            if (_calls == _warmup)
+                _begin = std::chrono::steady_clock::now();
+            if (!more()) {
+                if (_repro && _clock1 == 0.)
+                    _clock1 = Protected::benchClock();
+                release();
+                return false;
+            }
+            ++_calls;
+            return true;
+        }
+
+        void start () { _chrono.clear(); _chrono.start(); }
+        void stop () { _chrono.stop(); add (_chrono.realtime()); }
+
+        /// Records the time of the current repetition, when measured by the caller
+        void add (double t)
+        {
+            if (_calls > _warmup)
+                _samples.push_back (t);
+        }
+
+        /// Records the time of a sub-step of the current repetition, reported by its median
+        void phase (const std::string& name, double t)
+        {
+            if (_calls <= _warmup) return;
+            for (auto& p : _phases)
+                if (p.first == name) { p.second.push_back (t); return; }
+            _phases.emplace_back (name, std::vector<double> (1, t));
+        }
+
+        /// Runs and times the routine f() until next() stops
+        template <class Routine>
+        BenchmarkStats run (Routine f)
+        {
+            while (next()) {
+                start(); f(); stop();
+            }
+            return stats();
+        }
+
+        BenchmarkStats stats () const { return Protected::benchStats (_samples); }
+
+        /// Reasons why the measurement is unstable in reproducible mode, empty if it is stable
+        std::string instability () const
+        {
+            if (!_repro) return "";
+            std::ostringstream why;
+            const BenchmarkStats st = stats();
+            if (!_pinned)
+                why << " unpinned";
+            if (st.reps > 1 && st.median > 0. && st.stddev > _maxcv * st.median)
+                why << " cv=" << st.stddev / st.median;
+            if (_clock0 > 0. && _clock1 > 0. && std::abs (_clock1/_clock0 - 1.) > _maxdrift)
+                why << " clock-drift=" << _clock1/_clock0 - 1.;
+            if (_busy >= 0 && _cores > 0 && _busy > _cores - long(MAX_THREADS))
+                why << " busy=" << _busy;
+            return Protected::trim (why.str());
+        }
+
+        bool stable () const { return instability().empty(); }
+
+        /// Clock in GHz estimated at the beginning of the run in reproducible mode, 0 otherwise
+        double clock () const { return _clock0; }
+
+        /*! Writes the text line of the benchmark followed by the json or csv record.
+         *  @param flops  number of field operations of one repetition (0 when irrelevant)
+         *  @param extra  free text inserted before the command line in the text report
+         */
+        void report (double flops, const std::string& extra = "", std::ostream& os = std::cout) const
+        {
+            const BenchmarkStats st = stats();
+            const double gfops = (flops > 0. && st.median > 0.) ? flops / st.median / 1e9 : 0.;
+            os << "Time: " << st.median << " Gfops: ";
+            if (flops > 0.) os << gfops; else os << "Irrelevant";
+            os << " p95: " << st.p95 << " reps: " << st.reps;
+            for (auto& p : _phases)
+                os << ' ' << p.first << ": " << Protected::benchStats (p.second).median;
+            const std::string why = instability();
+            if (_repro)
+                os << " clock: " << _clock0 << " GHz turbo: " << _turbo;
+            if (!why.empty())
+                os << ((_repro == 2) ? " REFUSED" : "") << " unstable: " << why;
+            os << extra;
+            writeCommandString (os, _args) << std::endl;
+
+            if (_format != "json" && _format != "csv")
+                return;
+            if (_repro == 2 && !why.empty())
+                return;
+            std::ostringstream cmd;
+            writeCommandString (cmd, _args);
+            std::ofstream file;
+            bool fresh = true;
+            if (!_output.empty()) {
+                std::ifstream probe (_output);
+                fresh = !probe.good() || probe.peek() == std::ifstream::traits_type::eof();
+                file.open (_output, std::ios::app);
+            }
+            std::ostream& out = _output.empty() ? os : file;
+            if (_format == "json")
+                writeJSON (out, st, flops, gfops, Protected::trim (cmd.str()));
+            else
+                writeCSV (out, st, flops, gfops, Protected::trim (cmd.str()), fresh);
+        }
+
+    private:
+        /// Whether the timed repetitions must go on
+        bool more () const
+        {
+            const size_t n = _samples.size();
+            if (n >= _maxreps)
+                return false;
+            if (n >= _minreps) {
+                if (_target <= 0.)
+                    return false;
+                BenchmarkStats st = Protected::benchStats (_samples);
+                if (n > 1 && st.ci <= _target * st.mean)
+                    return false;
+                if (elapsed() >= _maxtime)
+                    return false;
+            }
+            return true;
+        }
+
+        /// Pins the threads and records the state of the host before the first repetition
+        void prepare ()
+        {
+            _prepared = true;
+            _busy = Protected::benchBusy();
+            _cores = Protected::benchCores();
+            _turbo = Protected::benchTurbo();
+            _pinned = Protected::benchPinThreads (_affinity);
+            _clock0 = Protected::benchClock();
+        }
+
+        /// Restores the affinity of the threads once the repetitions are over
+        void release ()
+        {
+            if (_pinned && !_released)
+                Protected::benchUnpinThreads (_affinity);
+            _released = true;
+        }
+
+        double elapsed () const
+        {
+            return std::chrono::duration<double> (std::chrono::steady_clock::now() - _begin).count();
+        }
+
+        void writeJSON (std::ostream& out, const BenchmarkStats& st, double flops, double gfops,
+                        const std::string& cmd) const
+        {
+            using Protected::jsonEscape;
+            out << "{\"benchmark\":\"" << jsonEscape (_name) << "\""
+                << ",\"args\":\"" << jsonEscape (cmd) << "\""
+                << ",\"host\":\"" << jsonEscape (Protected::benchHost()) << "\""
+                << ",\"cpu\":\"" << jsonEscape (Protected::benchCPU()) << "\""
+                << ",\"blas\":\"" << jsonEscape (Protected::benchBLAS()) << "\""
+                << ",\"compiler\":\"" << jsonEscape (Protected::benchCompiler()) << "\""
+                << ",\"threads\":" << MAX_THREADS
+                << ",\"date\":\"" << Protected::benchDate() << "\""
+                << ",\"warmup\":" << _warmup
+                << ",\"reps\":" << st.reps
+                << ",\"min\":" << st.min << ",\"median\":" << st.median << ",\"mean\":" << st.mean
+                << ",\"p95\":" << st.p95 << ",\"max\":" << st.max
+                << ",\"stddev\":" << st.stddev << ",\"ci\":" << st.ci
+                << ",\"flops\":" << flops << ",\"gfops\":" << gfops
+                << ",\"phases\":{";
+            for (size_t i = 0; i < _phases.size(); ++i)
+                out << (i ? "," : "") << "\"" << jsonEscape (_phases[i].first) << "\":"
+                    << Protected::benchStats (_phases[i].second).median;
+            out << "}";
+            if (_repro)
+                out << ",\"clock\":" << _clock0 << ",\"turbo\":\"" << _turbo << "\""
+                    << ",\"stable\":" << (stable() ? "true" : "false")
+                    << ",\"unstable\":\"" << jsonEscape (instability()) << "\"";
+            out << "}" << std::endl;
+        }
+
+        void writeCSV (std::ostream& out, const BenchmarkStats& st, double flops, double gfops,
+                       const std::string& cmd, bool header) const
+        {
+            using Protected::csvEscape;
+            if (header)
+                out << "benchmark,args,host,cpu,blas,compiler,threads,date,warmup,reps,"
+                    << "min,median,mean,p95,max,stddev,ci,flops,gfops,phases,clock,turbo,stable" << std::endl;
+            out << csvEscape (_name) << ',' << csvEscape (cmd) << ','
+                << csvEscape (Protected::benchHost()) << ',' << csvEscape (Protected::benchCPU()) << ','
+                << csvEscape (Protected::benchBLAS()) << ',' << csvEscape (Protected::benchCompiler()) << ','
+                << MAX_THREADS << ',' << Protected::benchDate() << ','
+                << _warmup << ',' << st.reps << ','
+                << st.min << ',' << st.median << ',' << st.mean << ',' << st.p95 << ',' << st.max << ','
+                << st.stddev << ',' << st.ci << ',' << flops << ',' << gfops << ',';
+            for (size_t i = 0; i < _phases.size(); ++i)
+                out << (i ? ";" : "") << csvEscape (_phases[i].first) << '='
+                    << Protected::benchStats (_phases[i].second).median;
+            out << ',' << _clock0 << ',' << _turbo << ',' << (stable() ? 1 : 0) << std::endl;
+        }
+
+        std::string _name;
+        Argument* _args;
+        size_t _minreps, _maxreps, _warmup, _calls;
+        double _target, _maxtime;
+        std::string _format, _output;
+        int _repro; //!< 0: off, 1: annotate, 2: refuse the unstable measurements
+        double _maxcv, _maxdrift;
+        bool _prepared = false, _pinned = false, _released = false;
+        Protected::BenchAffinity _affinity;
+        double _clock0 = 0., _clock1 = 0.;
+        long _busy = -1, _cores = 0;
+        std::string _turbo = "unknown";
+        std::vector<double> _samples;
+        std::vector<std::pair<std::string, std::vector<double> > > _phases;
+        Timer _chrono;
+        std::chrono::steady_clock::time_point _begin;
+    };
+
+    /*! Median time of f() measured in reproducible mode, for the autotune programs.
+     *  setup() is run untimed before each repetition. An unstable measurement is run again,
+     *  at most maxtries times; if none is stable, the fastest median is returned, since the
+     *  perturbations only slow the routine down.
+     *  Each measurement stops after maxreps repetitions or maxtime seconds, the autotune
+     *  programs timing many sizes: the limits of the benchmarks are too loose for them.
+     */
+    template <class Setup, class Routine>
+    double tuneTime (const std::string& name, Setup setup, Routine f, size_t minreps = 3, size_t maxtries = 3,
+                     size_t maxreps = 10, double maxtime = 2.)
+    {
+        double best = 0.;
+        for (size_t t = 0; t < maxtries; ++t) {
+            Benchmark bench (name, nullptr, minreps);
+            bench.reproducible();
+            bench.limit (maxreps, maxtime);
+            while (bench.next()) {
+                setup();
+                bench.start(); f(); bench.stop();
+            }
+            const double median = bench.stats().median;
+            if (bench.stable())
+                return median;
+            if (t == 0 || median < best)
+                best = median;
+            std::cerr << "# unstable measurement of " << name << ": " << bench.instability()
+                      << ((t+1 < maxtries) ? ", measuring again" : "") << std::endl;
+        }
+        return best;
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_utils_bench_utils_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) FFLAS-FFPACK
+ * Written by Clément Pernet
+ * This file is Free Software and part of FFLAS-FFPACK.
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/*! @file utils/instrumentation.h
+ * @ingroup util
+ * @brief Counters and timers of the hot routines of the library.
+ *
+ * When __FFLASFFPACK_INSTRUMENTATION is defined (configure --enable-instrumentation),
+ * every call to fgemm, ftrsm, freduce, finit, fconvert, applyP, MatrixApplyS/T,
+ * the RNS conversions and the sparse products records its number of calls, field
+ * operations, bytes moved and wall time.
+ * Otherwise FFLASFFPACK_INSTRUMENT expands to nothing: the arguments are not even evaluated.
+ *
+ * A call made while another call to the same routine is running in the same thread
+ * (recursion, or a sub-call such as the rows of a matrix freduce) is only recorded
+ * in the breakdown by recursion level: the totals count the outermost calls.
+ * In parallel regions the times of the tasks run by the different threads add up.
+ * The counters are meant to be read outside of the parallel regions.
+ *
+ * @code
+ *   {
+ *       FFLAS::ProfileRegion region ("pluq", std::cerr); // reported on exit
+ *       FFPACK::PLUQ (F, FFLAS::FflasNonUnit, m, n, A, lda, P, Q);
+ *   }
+ *   double t = FFLAS::Instrumentation::counters (FFLAS::Instrumentation::fgemm).time;
+ * @endcode
+ */
+
+#ifndef __FFLASFFPACK_utils_instrumentation_H
+#define __FFLASFFPACK_utils_instrumentation_H
+
+#include "fflas-ffpack/fflas-ffpack-config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace FFLAS {
+    namespace Instrumentation {
+
+        enum Routine {
+            fgemm = 0,
+            ftrsm,
+            freduce,
+            finit,
+            fconvert,
+            applyP,
+            MatrixApplyS,
+            MatrixApplyT,
+            rns_init,
+            rns_convert,
+            fspmv,
+            NbRoutines
+        };
+
+        inline const char* name (Routine r)
+        {
+            static const char* names[NbRoutines] = { "fgemm", "ftrsm", "freduce", "finit", "fconvert",
+                                                     "applyP", "MatrixApplyS", "MatrixApplyT",
+                                                     "rns_init", "rns_convert", "fspmv" };
+            return names[r];
+        }
+
+        /// Number of recursion levels of the breakdown, deeper calls are added to the last one
+        const size_t MaxLevel = 8;
+
+#ifdef __FFLASFFPACK_INSTRUMENTATION
+        constexpr bool enabled = true;
+#else
+        constexpr bool enabled = false;
+#endif
+
+        struct Counters {
+            uint64_t calls = 0;
+            double flops = 0.;   //!< field operations
+            double bytes = 0.;   //!< bytes read and written
+            double time = 0.;    //!< wall time in seconds
+            uint64_t levelCalls[MaxLevel] = {};
+            double levelFlops[MaxLevel] = {};
+            double levelTime[MaxLevel] = {};
+
+            Counters& operator+= (const Counters& c)
+            {
+                calls += c.calls; flops += c.flops; bytes += c.bytes; time += c.time;
+                for (size_t l = 0; l < MaxLevel; ++l) {
+                    levelCalls[l] += c.levelCalls[l];
+                    levelFlops[l] += c.levelFlops[l];
+                    levelTime[l] += c.levelTime[l];
+                }
+                return *this;
+            }
+            Counters& operator-= (const Counters& c)
+            {
+                calls -= c.calls; flops -= c.flops; bytes -= c.bytes; time -= c.time;
+                for (size_t l = 0; l < MaxLevel; ++l) {
+                    levelCalls[l] -= c.levelCalls[l];
+                    levelFlops[l] -= c.levelFlops[l];
+                    levelTime[l] -= c.levelTime[l];
+                }
+                return *this;
+            }
+        };
+
+        namespace Protected {
+
+            /// Counters of one thread, kept alive by the registry after the thread exits
+            struct ThreadCounters {
+                Counters c[NbRoutines];
+                size_t depth[NbRoutines] = {};
+            };
+
+            inline std::mutex& registryMutex ()
+            {
+                static std::mutex mtx;
+                return mtx;
+            }
+
+            inline std::vector<std::shared_ptr<ThreadCounters> >& registry ()
+            {
+                static std::vector<std::shared_ptr<ThreadCounters> > reg;
+                return reg;
+            }
+
+            inline ThreadCounters& local ()
+            {
+                thread_local std::shared_ptr<ThreadCounters> t;
+                if (!t) {
+                    t = std::make_shared<ThreadCounters>();
+                    std::lock_guard<std::mutex> lock (registryMutex());
+                    registry().push_back (t);
+                }
+                return *t;
+            }
+        }
+
+        /// Sum over the threads of the counters of the routine r
+        inline Counters counters (Routine r)
+        {
+            Counters s;
+            std::lock_guard<std::mutex> lock (Protected::registryMutex());
+            for (auto& t : Protected::registry())
+                s += t->c[r];
+            return s;
+        }
+
+        /// Sets all the counters to zero
+        inline void reset ()
+        {
+            std::lock_guard<std::mutex> lock (Protected::registryMutex());
+            for (auto& t : Protected::registry())
+                for (size_t r = 0; r < NbRoutines; ++r)
+                    t->c[r] = Counters();
+        }
+
+        /// Writes one line per routine called, with its breakdown by recursion level
+        inline std::ostream& report (std::ostream& os, const Counters* c)
+        {
+            std::ios::fmtflags flags (os.flags());
+            os << std::left << std::setw (14) << "routine" << std::right
+               << std::setw (10) << "calls" << std::setw (12) << "time (s)"
+               << std::setw (12) << "Gfops" << std::setw (12) << "GB/s" << "  calls/time by level" << std::endl;
+            for (size_t r = 0; r < NbRoutines; ++r) {
+                if (!c[r].calls) continue;
+                os << std::left << std::setw (14) << name (Routine (r)) << std::right
+                   << std::setw (10) << c[r].calls
+                   << std::setw (12) << std::setprecision (4) << c[r].time
+                   << std::setw (12) << ((c[r].time > 0.) ? c[r].flops / c[r].time / 1e9 : 0.)
+                   << std::setw (12) << ((c[r].time > 0.) ? c[r].bytes / c[r].time / 1e9 : 0.) << ' ';
+                for (size_t l = 0; l < MaxLevel; ++l)
+                    if (c[r].levelCalls[l])
+                        os << ' ' << l << ':' << c[r].levelCalls[l] << '/' << c[r].levelTime[l];
+                os << std::endl;
+            }
+            os.flags (flags);
+            return os;
+        }
+
+        inline std::ostream& report (std::ostream& os)
+        {
+            Counters c[NbRoutines];
+            for (size_t r = 0; r < NbRoutines; ++r)
+                c[r] = counters (Routine (r));
+            return report (os, c);
+        }
+
+        /// Records the call in the scope of which it lives
+        class Scope {
+        public:
+            Scope (Routine r, double flops, double bytes) :
+                _t (Protected::local()), _r (r), _flops (flops), _bytes (bytes),
+                _start (std::chrono::steady_clock::now())
+            {
+                _level = _t.depth[r]++;
+            }
+
+            ~Scope ()
+            {
+                const double dt = std::chrono::duration<double> (std::chrono::steady_clock::now() - _start).count();
+                --_t.depth[_r];
+                Counters& c = _t.c[_r];
+                const size_t l = std::min (_level, MaxLevel-1);
+                ++c.levelCalls[l];
+                c.levelFlops[l] += _flops;
+                c.levelTime[l] += dt;
+                if (!_level) {
+                    ++c.calls;
+                    c.flops += _flops;
+                    c.bytes += _bytes;
+                    c.time += dt;
+                }
+            }
+
+        private:
+            Scope (const Scope&) = delete;
+            Scope& operator= (const Scope&) = delete;
+
+            Protected::ThreadCounters& _t;
+            Routine _r;
+            size_t _level;
+            double _flops, _bytes;
+            std::chrono::steady_clock::time_point _start;
+        };
+
+    } // Instrumentation
+
+    /*! Counters of the calls made during the lifetime of the region.
+     *  When built with an output stream, the region writes its report on exit.
+     */
+    class ProfileRegion {
+    public:
+        ProfileRegion (const std::string& name = "") : _name (name), _os (nullptr) { restart(); }
+        ProfileRegion (const std::string& name, std::ostream& os) : _name (name), _os (&os) { restart(); }
+
+        ~ProfileRegion ()
+        {
+            if (_os) report (*_os);
+        }
+
+        /// Forgets the calls made so far in the region
+        void restart ()
+        {
+            for (size_t r = 0; r < Instrumentation::NbRoutines; ++r)
+                _start[r] = Instrumentation::counters (Instrumentation::Routine (r));
+        }
+
+        Instrumentation::Counters counters (Instrumentation::Routine r) const
+        {
+            Instrumentation::Counters c = Instrumentation::counters (r);
+            c -= _start[r];
+            return c;
+        }
+
+        std::ostream& report (std::ostream& os) const
+        {
+            os << "Profile region " << _name;
+            if (!Instrumentation::enabled)
+                return os << ": instrumentation disabled (compile with -D__FFLASFFPACK_INSTRUMENTATION)" << std::endl;
+            os << std::endl;
+            Instrumentation::Counters c[Instrumentation::NbRoutines];
+            for (size_t r = 0; r < Instrumentation::NbRoutines; ++r)
+                c[r] = counters (Instrumentation::Routine (r));
+            return Instrumentation::report (os, c);
+        }
+
+    private:
+        ProfileRegion (const ProfileRegion&) = delete;
+        ProfileRegion& operator= (const ProfileRegion&) = delete;
+
+        std::string _name;
+        std::ostream* _os;
+        Instrumentation::Counters _start[Instrumentation::NbRoutines];
+    };
+
+} // FFLAS
+
+#ifdef __FFLASFFPACK_INSTRUMENTATION
+#define FFLASFFPACK_INSTRUMENT(routine, flops, bytes) \
+    FFLAS::Instrumentation::Scope fflasffpack_instrumentation_scope (FFLAS::Instrumentation::routine, double(flops), double(bytes))
+#else
+#define FFLASFFPACK_INSTRUMENT(routine, flops, bytes)
+#endif
+
+#endif // __FFLASFFPACK_utils_instrumentation_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
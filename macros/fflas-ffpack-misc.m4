@@ -82,3 +82,19 @@ fi
 
 
 ])
+
+AC_DEFUN([FF_INSTRUMENTATION],
+[
+
+AC_MSG_CHECKING([whether to instrument the hot routines])
+
+AC_ARG_ENABLE(instrumentation,
+[AC_HELP_STRING([--enable-instrumentation], [ Record the calls, operations, bytes and time of fgemm, ftrsm, freduce, the permutations and the RNS conversions (see fflas-ffpack/utils/instrumentation.h)])])
+AS_IF([test "x$enable_instrumentation" = "xyes"],
+	    [
+		AC_MSG_RESULT(yes)
+		AC_DEFINE(INSTRUMENTATION,1,[Define if the hot routines record their counters])
+	    ],
+	    [AC_MSG_RESULT(no)]
+     )
+])